@@ -0,0 +1,57 @@
+/*
+ * Museum Escape - Guard AI Scheduler Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "AIScheduler.h"
+#include "Guard.h"
+#include <algorithm>
+
+namespace {
+    const std::size_t SLICE_GUARDS = 8; // Guards thought about between budget checks
+}
+
+AIScheduler::AIScheduler() : cursor(0) {}
+
+const std::vector<Guard*>& AIScheduler::update(const std::vector<Guard*>& guards, const Player& player,
+                                               std::chrono::microseconds budget) {
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point deadline = Clock::now() + budget;
+
+    if (!startFrame(guards.size())) return thinking;
+    do {
+        thinkSlice(guards, player, SLICE_GUARDS);
+    } while (thinking.size() < guards.size() && Clock::now() < deadline);
+    return thinking;
+}
+
+const std::vector<Guard*>& AIScheduler::update(const std::vector<Guard*>& guards, const Player& player,
+                                               std::size_t turns) {
+    if (startFrame(guards.size())) thinkSlice(guards, player, std::max(turns, SLICE_GUARDS));
+    return thinking;
+}
+
+bool AIScheduler::startFrame(std::size_t guardCount) {
+    thinking.clear();
+    if (guardCount == 0) return false;
+    if (cursor >= guardCount) cursor = 0; // The room (or its guard list) changed
+    return true;
+}
+
+// Never more than one turn per guard per frame
+void AIScheduler::thinkSlice(const std::vector<Guard*>& guards, const Player& player, std::size_t turns) {
+    std::size_t count = guards.size();
+    for (std::size_t i = 0; i < turns && thinking.size() < count; ++i) {
+        Guard* guard = guards[cursor];
+        guard->think(player);
+        thinking.push_back(guard);
+        if (++cursor == count) cursor = 0;
+    }
+}
+
+void AIScheduler::reset() {
+    cursor = 0;
+    thinking.clear();
+}
+
+std::size_t AIScheduler::getThinkCount() const { return thinking.size(); }
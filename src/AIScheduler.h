@@ -0,0 +1,43 @@
+#ifndef AISCHEDULER_H
+#define AISCHEDULER_H
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+class Guard;
+class Player;
+
+// AIScheduler - hands out Guard::think() turns under a per-frame budget.
+// Guards are visited round-robin from wherever the previous frame stopped, so
+// with hundreds of guards each one still thinks every few frames while the
+// frame cost stays flat. Motion (Guard::update) is not scheduled - it runs
+// every tick for every guard.
+//
+// The budget is either time (normal play) or a number of turns. A time budget
+// hands out a different number of turns on a faster machine, so fixed-step
+// runs (replays, --bench) use turns to play out the same way everywhere.
+class AIScheduler {
+private:
+    std::size_t cursor;
+    std::vector<Guard*> thinking; // Guards that had a turn this frame
+
+public:
+    AIScheduler();
+
+    // Run think() for as many guards as the budget allows (at least a few, so
+    // everyone gets a turn eventually). Returns the guards that thought; valid
+    // until the next call.
+    const std::vector<Guard*>& update(const std::vector<Guard*>& guards, const Player& player,
+                                      std::chrono::microseconds budget);
+    const std::vector<Guard*>& update(const std::vector<Guard*>& guards, const Player& player, std::size_t turns);
+
+    void reset();
+    std::size_t getThinkCount() const; // Turns handed out last frame
+
+private:
+    bool startFrame(std::size_t guardCount); // False if there is no one to think
+    void thinkSlice(const std::vector<Guard*>& guards, const Player& player, std::size_t turns);
+};
+
+#endif // AISCHEDULER_H
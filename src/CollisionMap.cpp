@@ -0,0 +1,180 @@
+/*
+ * Museum Escape - Collision Map Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "CollisionMap.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+    // Keeps boxes that exactly touch a tile edge from counting as inside the tile
+    const float EDGE_EPSILON = 0.001f;
+}
+
+CollisionMap::CollisionMap() : origin(0.0f, 0.0f), size(0.0f, 0.0f), columns(0), rows(0) {}
+
+CollisionMap::CollisionMap(float x, float y, float width, float height)
+    : origin(x, y),
+      size(width, height),
+      columns(std::max(0, static_cast<int>(std::ceil(width / TILE_SIZE)))),
+      rows(std::max(0, static_cast<int>(std::ceil(height / TILE_SIZE)))),
+      solid(static_cast<std::size_t>(columns) * rows, 0) {}
+
+void CollisionMap::addSolidRect(const sf::FloatRect& rect) {
+    int firstColumn = std::max(0, columnAt(rect.position.x));
+    int lastColumn = std::min(columns - 1, columnAt(rect.position.x + rect.size.x - EDGE_EPSILON));
+    int firstRow = std::max(0, rowAt(rect.position.y));
+    int lastRow = std::min(rows - 1, rowAt(rect.position.y + rect.size.y - EDGE_EPSILON));
+
+    for (int row = firstRow; row <= lastRow; ++row) {
+        for (int column = firstColumn; column <= lastColumn; ++column) {
+            solid[static_cast<std::size_t>(row) * columns + column] = 1;
+        }
+    }
+}
+
+bool CollisionMap::isSolidTile(int column, int row) const {
+    if (column < 0 || row < 0 || column >= columns || row >= rows) return true;
+    return solid[static_cast<std::size_t>(row) * columns + column] != 0;
+}
+
+bool CollisionMap::isSolidAt(const sf::Vector2f& point) const {
+    return isSolidTile(columnAt(point.x), rowAt(point.y));
+}
+
+bool CollisionMap::overlaps(const sf::FloatRect& box) const {
+    int lastColumn = columnAt(box.position.x + box.size.x - EDGE_EPSILON);
+    int lastRow = rowAt(box.position.y + box.size.y - EDGE_EPSILON);
+    for (int row = rowAt(box.position.y + EDGE_EPSILON); row <= lastRow; ++row) {
+        for (int column = columnAt(box.position.x + EDGE_EPSILON); column <= lastColumn; ++column) {
+            if (isSolidTile(column, row)) return true;
+        }
+    }
+    return false;
+}
+
+int CollisionMap::tileAt(const sf::Vector2f& point) const {
+    int column = columnAt(point.x);
+    int row = rowAt(point.y);
+    if (column < 0 || row < 0 || column >= columns || row >= rows) return -1;
+    return row * columns + column;
+}
+
+sf::Vector2f CollisionMap::tileCenter(int tile) const {
+    return {origin.x + (tile % columns + 0.5f) * TILE_SIZE, origin.y + (tile / columns + 0.5f) * TILE_SIZE};
+}
+
+int CollisionMap::getTileCount() const { return columns * rows; }
+
+sf::Vector2f CollisionMap::sweep(const sf::FloatRect& box, const sf::Vector2f& delta) const {
+    // Axis-separated so the box slides along walls instead of sticking to them
+    float dx = sweepX(box, delta.x);
+    sf::FloatRect moved = box;
+    moved.position.x += dx;
+    float dy = sweepY(moved, delta.y);
+    return {dx, dy};
+}
+
+// Only the tile columns between the leading edge and its destination are
+// tested, against the rows the box spans - the broad phase is the grid itself.
+float CollisionMap::sweepX(const sf::FloatRect& box, float dx) const {
+    if (dx == 0.0f) return 0.0f;
+
+    int firstRow = rowAt(box.position.y + EDGE_EPSILON);
+    int lastRow = rowAt(box.position.y + box.size.y - EDGE_EPSILON);
+
+    if (dx > 0.0f) {
+        float right = box.position.x + box.size.x;
+        dx = std::min(dx, std::max(0.0f, origin.x + size.x - right));
+        int lastColumn = columnAt(right + dx - EDGE_EPSILON);
+        for (int column = columnAt(right - EDGE_EPSILON) + 1; column <= lastColumn; ++column) {
+            for (int row = firstRow; row <= lastRow; ++row) {
+                if (isSolidTile(column, row)) return std::max(0.0f, origin.x + column * TILE_SIZE - right);
+            }
+        }
+    } else {
+        float left = box.position.x;
+        dx = std::max(dx, std::min(0.0f, origin.x - left));
+        int lastColumn = columnAt(left + dx + EDGE_EPSILON);
+        for (int column = columnAt(left + EDGE_EPSILON) - 1; column >= lastColumn; --column) {
+            for (int row = firstRow; row <= lastRow; ++row) {
+                if (isSolidTile(column, row)) return std::min(0.0f, origin.x + (column + 1) * TILE_SIZE - left);
+            }
+        }
+    }
+    return dx;
+}
+
+float CollisionMap::sweepY(const sf::FloatRect& box, float dy) const {
+    if (dy == 0.0f) return 0.0f;
+
+    int firstColumn = columnAt(box.position.x + EDGE_EPSILON);
+    int lastColumn = columnAt(box.position.x + box.size.x - EDGE_EPSILON);
+
+    if (dy > 0.0f) {
+        float bottom = box.position.y + box.size.y;
+        dy = std::min(dy, std::max(0.0f, origin.y + size.y - bottom));
+        int lastRow = rowAt(bottom + dy - EDGE_EPSILON);
+        for (int row = rowAt(bottom - EDGE_EPSILON) + 1; row <= lastRow; ++row) {
+            for (int column = firstColumn; column <= lastColumn; ++column) {
+                if (isSolidTile(column, row)) return std::max(0.0f, origin.y + row * TILE_SIZE - bottom);
+            }
+        }
+    } else {
+        float top = box.position.y;
+        dy = std::max(dy, std::min(0.0f, origin.y - top));
+        int lastRow = rowAt(top + dy + EDGE_EPSILON);
+        for (int row = rowAt(top + EDGE_EPSILON) - 1; row >= lastRow; --row) {
+            for (int column = firstColumn; column <= lastColumn; ++column) {
+                if (isSolidTile(column, row)) return std::min(0.0f, origin.y + (row + 1) * TILE_SIZE - top);
+            }
+        }
+    }
+    return dy;
+}
+
+// Amanatides-Woo traversal: step into whichever neighbouring tile the segment
+// reaches first, so the cost is the number of tiles crossed
+bool CollisionMap::hasLineOfSight(const sf::Vector2f& a, const sf::Vector2f& b) const {
+    int column = columnAt(a.x);
+    int row = rowAt(a.y);
+    int endColumn = columnAt(b.x);
+    int endRow = rowAt(b.y);
+
+    float dx = b.x - a.x;
+    float dy = b.y - a.y;
+    int stepColumn = dx > 0.0f ? 1 : -1;
+    int stepRow = dy > 0.0f ? 1 : -1;
+    const float never = std::numeric_limits<float>::infinity();
+
+    // Segment parameter t (0..1) at the next column/row boundary, and per tile
+    float nextX = origin.x + (column + (dx > 0.0f ? 1 : 0)) * TILE_SIZE;
+    float nextY = origin.y + (row + (dy > 0.0f ? 1 : 0)) * TILE_SIZE;
+    float tMaxX = dx != 0.0f ? (nextX - a.x) / dx : never;
+    float tMaxY = dy != 0.0f ? (nextY - a.y) / dy : never;
+    float tDeltaX = dx != 0.0f ? TILE_SIZE / std::abs(dx) : never;
+    float tDeltaY = dy != 0.0f ? TILE_SIZE / std::abs(dy) : never;
+
+    // Bounded by the tile distance so float error can never loop forever
+    int remaining = std::abs(endColumn - column) + std::abs(endRow - row);
+    for (;;) {
+        if (isSolidTile(column, row)) return false;
+        if (remaining-- <= 0) return true;
+        if (tMaxX < tMaxY) {
+            column += stepColumn;
+            tMaxX += tDeltaX;
+        } else {
+            row += stepRow;
+            tMaxY += tDeltaY;
+        }
+    }
+}
+
+int CollisionMap::columnAt(float x) const { return static_cast<int>(std::floor((x - origin.x) / TILE_SIZE)); }
+int CollisionMap::rowAt(float y) const { return static_cast<int>(std::floor((y - origin.y) / TILE_SIZE)); }
+
+int CollisionMap::getColumns() const { return columns; }
+int CollisionMap::getRows() const { return rows; }
+sf::Vector2f CollisionMap::getOrigin() const { return origin; }
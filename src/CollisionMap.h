@@ -0,0 +1,58 @@
+#ifndef COLLISIONMAP_H
+#define COLLISIONMAP_H
+
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+
+// CollisionMap - a room's solid geometry as a grid of TILE_SIZE tiles.
+// Walls are rasterized into the grid when the level is built; everything outside
+// the room counts as solid. A move only looks at the tiles its box sweeps
+// through, so the cost depends on how far something moves, not on how many
+// walls the room has, and nothing can tunnel through a wall at low frame rates.
+class CollisionMap {
+public:
+    static constexpr float TILE_SIZE = 16.0f;
+
+private:
+    sf::Vector2f origin;
+    sf::Vector2f size;   // Exact room size; the last tile row/column may overhang it
+    int columns;
+    int rows;
+    std::vector<std::uint8_t> solid; // columns * rows, row-major
+
+public:
+    CollisionMap();
+    CollisionMap(float x, float y, float width, float height);
+
+    // Mark every tile the rectangle touches as solid
+    void addSolidRect(const sf::FloatRect& rect);
+
+    bool isSolidTile(int column, int row) const; // Out of range = solid
+    bool isSolidAt(const sf::Vector2f& point) const;
+    bool overlaps(const sf::FloatRect& box) const;
+
+    // Tile indices (row * columns + column) for pathfinding; -1 = outside the grid
+    int tileAt(const sf::Vector2f& point) const;
+    sf::Vector2f tileCenter(int tile) const;
+    int getTileCount() const;
+
+    // Swept AABB: how far the box can actually move along delta (x first, then y)
+    sf::Vector2f sweep(const sf::FloatRect& box, const sf::Vector2f& delta) const;
+
+    // True if no solid tile lies on the segment from a to b (grid DDA, visits
+    // each crossed tile once)
+    bool hasLineOfSight(const sf::Vector2f& a, const sf::Vector2f& b) const;
+
+    int getColumns() const;
+    int getRows() const;
+    sf::Vector2f getOrigin() const;
+
+private:
+    float sweepX(const sf::FloatRect& box, float dx) const;
+    float sweepY(const sf::FloatRect& box, float dy) const;
+    int columnAt(float x) const;
+    int rowAt(float y) const;
+};
+
+#endif // COLLISIONMAP_H
@@ -0,0 +1,110 @@
+#ifndef DEFAULTLEVEL_H
+#define DEFAULTLEVEL_H
+
+#include "ItemID.h"
+#include "LevelChecks.h"
+#include "LevelData.h"
+
+// The seven-room museum as constexpr tables (same content as assets/museum.lvl).
+// Lives in static read-only storage: using it costs no parsing, allocation or
+// fix-up, and the static_asserts below reject a broken museum at build time.
+
+inline constexpr RoomDef MUSEUM_ROOMS[] = {
+    {1, "Main Entrance",             0.0f, 0.0f, 800.0f, 600.0f, "assets/room1.png", "assets/room1_open.png", 0},
+    {2, "Ancient Artifacts Gallery", 0.0f, 0.0f, 800.0f, 600.0f, "assets/room2.png", "assets/room2_open.png", 0},
+    {3, "Medieval Weapons Hall",     0.0f, 0.0f, 800.0f, 600.0f, "assets/room3.png", "assets/room3_open.png", 0},
+    {4, "Security Control Room",     0.0f, 0.0f, 800.0f, 600.0f, "assets/room4.png", "assets/room4_open.png", 0},
+    {5, "Dark Archives",             0.0f, 0.0f, 800.0f, 600.0f, "assets/room5.png", "assets/room5_open.png", 0},
+    {6, "Laboratory",                0.0f, 0.0f, 800.0f, 600.0f, "assets/room6.png", "assets/room6_open.png", 0},
+    {7, "Director's Office",         0.0f, 0.0f, 800.0f, 600.0f, "assets/room7.png", "assets/room7_open.png", 1},
+};
+
+// Doors (invisible)
+inline constexpr DoorDef MUSEUM_DOORS[] = {
+    {1, 750.0f, 300.0f, 2, ""},
+    {2,  50.0f, 300.0f, 1, ""},
+    {2, 750.0f, 300.0f, 3, "blue_keycard"},
+    {3,  50.0f, 300.0f, 2, ""},
+    {3, 750.0f, 300.0f, 4, ""},
+    {4,  50.0f, 300.0f, 3, ""},
+    {4, 750.0f, 300.0f, 5, "yellow_keycard"},
+    {5,  50.0f, 300.0f, 4, ""},
+    {5, 750.0f, 300.0f, 6, "green_keycard"},
+    {6,  50.0f, 300.0f, 5, ""},
+    {6, 750.0f, 300.0f, 7, "master_keycard"},
+    {7,  50.0f, 300.0f, 6, ""},
+};
+
+inline constexpr ItemDef MUSEUM_ITEMS[] = {
+    {1, ItemDefType::Tool,     "Flashlight",       "flashlight",    "Illuminates dark areas", 150.0f, 150.0f},
+    {1, ItemDefType::Basic,    "Museum Map",       "Map of museum", "",                       650.0f, 150.0f},
+    {3, ItemDefType::Tool,     "Bolt Cutters",     "bolt_cutters",  "Cuts chains",            650.0f, 500.0f},
+    {3, ItemDefType::Basic,    "Red Keycard",      "Security card", "",                       150.0f, 150.0f},
+    {4, ItemDefType::Passcode, "Access Code Note", "4738",          "",                       150.0f, 500.0f},
+    {5, ItemDefType::Basic,    "Encrypted Note",   "Wire sequence", "",                       650.0f, 150.0f},
+    {6, ItemDefType::Basic,    "Evidence Log",     "Illegal experiments", "",                 150.0f, 150.0f},
+    {7, ItemDefType::Basic,    "Evidence File",    "The proof!",    "",                       400.0f, 300.0f},
+};
+
+// Two patrol points per guard, in guard order
+inline constexpr PatrolPointDef MUSEUM_PATROL_POINTS[] = {
+    {400.0f, 200.0f}, {600.0f, 200.0f},
+    {400.0f, 450.0f}, {400.0f, 150.0f},
+    {400.0f, 200.0f}, {600.0f, 200.0f},
+    {300.0f, 150.0f}, {600.0f, 150.0f},
+    {600.0f, 450.0f}, {300.0f, 450.0f},
+    {400.0f, 400.0f}, {600.0f, 400.0f},
+    {400.0f, 200.0f}, {600.0f, 200.0f},
+    {600.0f, 450.0f}, {400.0f, 450.0f},
+};
+
+inline constexpr GuardDef MUSEUM_GUARDS[] = {
+    {1, 400.0f, 200.0f, 100.0f,  0, 2},
+    {2, 400.0f, 450.0f, 110.0f,  2, 2},
+    {3, 400.0f, 200.0f, 100.0f,  4, 2},
+    {4, 300.0f, 150.0f, 110.0f,  6, 2},
+    {4, 600.0f, 450.0f, 110.0f,  8, 2},
+    {5, 400.0f, 400.0f, 120.0f, 10, 2},
+    {6, 400.0f, 200.0f, 115.0f, 12, 2},
+    {6, 600.0f, 450.0f, 115.0f, 14, 2},
+};
+
+inline constexpr PuzzleDef MUSEUM_PUZZLES[] = {
+    {2, PuzzleType::Pattern, "",                           "1324"},
+    {3, PuzzleType::Riddle,  "I speak without a mouth...", "echo"},
+    {4, PuzzleType::Lock,    "",                           "4738"},
+    {5, PuzzleType::Math,    "(60 - 12) = ?",              "048"},
+    {6, PuzzleType::Wire,    "",                           "Red,Yellow,Blue,Green,Purple"},
+};
+
+inline constexpr GameRule MUSEUM_RULES[] = {
+    {RuleTrigger::PuzzleSolved,   2,  INVALID_ITEM_ID,    RuleAction::SpawnKey,   "Blue Keycard",   "blue_keycard",   650.0f, 500.0f},
+    {RuleTrigger::PuzzleSolved,   4,  INVALID_ITEM_ID,    RuleAction::SpawnKey,   "Yellow Keycard", "yellow_keycard", 650.0f, 500.0f},
+    {RuleTrigger::PuzzleSolved,   5,  INVALID_ITEM_ID,    RuleAction::SpawnKey,   "Green Keycard",  "green_keycard",  650.0f, 500.0f},
+    {RuleTrigger::PuzzleSolved,   6,  INVALID_ITEM_ID,    RuleAction::SpawnKey,   "Master Keycard", "master_keycard", 650.0f, 500.0f},
+    {RuleTrigger::ItemCollected,  -1, "Evidence File"_id, RuleAction::Victory,    "",               "",               0.0f,   0.0f},
+    {RuleTrigger::TimerExpired,   -1, INVALID_ITEM_ID,    RuleAction::Defeat,     "",               "",               0.0f,   0.0f},
+    {RuleTrigger::PlayerDetected, -1, INVALID_ITEM_ID,    RuleAction::WarnPlayer, "CAUGHT!",        "",               0.0f,   0.0f},
+};
+
+template<typename T, std::uint32_t N>
+constexpr std::uint32_t levelTableSize(const T (&)[N]) { return N; }
+
+inline constexpr LevelView DEFAULT_MUSEUM_LEVEL = {
+    MUSEUM_ROOMS, levelTableSize(MUSEUM_ROOMS),
+    nullptr, 0, // No interior walls - the room edges are the only obstacles
+    MUSEUM_DOORS, levelTableSize(MUSEUM_DOORS),
+    MUSEUM_ITEMS, levelTableSize(MUSEUM_ITEMS),
+    MUSEUM_GUARDS, levelTableSize(MUSEUM_GUARDS),
+    MUSEUM_PATROL_POINTS, levelTableSize(MUSEUM_PATROL_POINTS),
+    MUSEUM_PUZZLES, levelTableSize(MUSEUM_PUZZLES),
+    MUSEUM_RULES, levelTableSize(MUSEUM_RULES),
+    1, 100.0f, 100.0f
+};
+
+static_assert(levelRoomReferencesValid(DEFAULT_MUSEUM_LEVEL), "Museum: a door, item, guard or puzzle refers to a missing room");
+static_assert(levelPatrolsInBounds(DEFAULT_MUSEUM_LEVEL), "Museum: a guard or patrol point lies outside its room");
+static_assert(levelKeysObtainable(DEFAULT_MUSEUM_LEVEL), "Museum: a locked door's key can never be obtained");
+static_assert(levelHasExit(DEFAULT_MUSEUM_LEVEL), "Museum: no exit room");
+
+#endif // DEFAULTLEVEL_H
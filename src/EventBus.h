@@ -0,0 +1,55 @@
+#ifndef EVENTBUS_H
+#define EVENTBUS_H
+
+#include <functional>
+#include <tuple>
+#include <variant>
+#include <vector>
+
+// EventBus - typed, queued publish/subscribe.
+// publish() only appends to a queue; dispatch() delivers everything queued so far
+// (including events raised by handlers) to the subscribers of each event type.
+// Queuing means handlers can freely modify rooms/items without invalidating
+// whatever loop raised the event.
+template <typename... Events>
+class EventBus {
+private:
+    using Event = std::variant<Events...>;
+
+    template <typename E>
+    using HandlerList = std::vector<std::function<void(const E&)>>;
+
+    std::vector<Event> queue;
+    std::vector<Event> dispatching;
+    std::tuple<HandlerList<Events>...> handlers;
+
+public:
+    template <typename E>
+    void subscribe(std::function<void(const E&)> handler) {
+        std::get<HandlerList<E>>(handlers).push_back(std::move(handler));
+    }
+
+    template <typename E>
+    void publish(const E& event) {
+        queue.emplace_back(event);
+    }
+
+    void dispatch() {
+        while (!queue.empty()) {
+            dispatching.swap(queue);
+            for (const Event& event : dispatching) {
+                std::visit([this](const auto& e) {
+                    using E = std::decay_t<decltype(e)>;
+                    for (auto& handler : std::get<HandlerList<E>>(handlers)) handler(e);
+                }, event);
+            }
+            dispatching.clear();
+        }
+    }
+
+    void clearQueue() {
+        queue.clear();
+    }
+};
+
+#endif // EVENTBUS_H
@@ -0,0 +1,62 @@
+/*
+ * Museum Escape - Frame Arena Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "FrameArena.h"
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
+
+FrameArena::FrameArena(std::size_t capacityBytes)
+    : buffer(new std::byte[capacityBytes]), capacity(capacityBytes), used(0), peak(0), failed(0) {}
+
+void* FrameArena::allocate(std::size_t bytes, std::size_t alignment) {
+    std::uintptr_t base = reinterpret_cast<std::uintptr_t>(buffer.get());
+    std::size_t start = ((base + used + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1)) - base;
+    if (start > capacity || bytes > capacity - start) {
+        ++failed;
+        return nullptr;
+    }
+    used = start + bytes;
+    peak = std::max(peak, used);
+    return buffer.get() + start;
+}
+
+std::string_view FrameArena::format(const char* pattern, ...) {
+    // Write straight into the free space, then keep only what was written
+    std::size_t room = capacity - used;
+    if (room == 0) {
+        ++failed;
+        return {};
+    }
+    char* text = reinterpret_cast<char*>(buffer.get() + used);
+    va_list arguments;
+    va_start(arguments, pattern);
+    int length = std::vsnprintf(text, room, pattern, arguments);
+    va_end(arguments);
+    if (length < 0) return {};
+    if (static_cast<std::size_t>(length) >= room) {
+        ++failed;
+        length = static_cast<int>(room - 1);
+    }
+    used += static_cast<std::size_t>(length) + 1;
+    peak = std::max(peak, used);
+    return {text, static_cast<std::size_t>(length)};
+}
+
+std::string_view FrameArena::concat(std::string_view first, std::string_view second) {
+    char* text = static_cast<char*>(allocate(first.size() + second.size(), 1));
+    if (!text) return {};
+    std::memcpy(text, first.data(), first.size());
+    std::memcpy(text + first.size(), second.data(), second.size());
+    return {text, first.size() + second.size()};
+}
+
+void FrameArena::reset() { used = 0; }
+
+std::size_t FrameArena::getUsed() const { return used; }
+std::size_t FrameArena::getPeak() const { return peak; }
+std::size_t FrameArena::getCapacity() const { return capacity; }
+std::uint64_t FrameArena::getFailedCount() const { return failed; }
@@ -0,0 +1,55 @@
+#ifndef FRAMEARENA_H
+#define FRAMEARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <string_view>
+#include <type_traits>
+
+// FrameArena - scratch memory that lives for one frame. The buffer is reserved
+// once; allocating is a pointer bump and reset() at the top of each frame
+// frees everything together, so transient strings and vertices never touch the
+// heap. Nothing allocated here may be kept past the frame.
+class FrameArena {
+public:
+    static constexpr std::size_t DEFAULT_CAPACITY = 64 * 1024;
+
+private:
+    std::unique_ptr<std::byte[]> buffer;
+    std::size_t capacity;
+    std::size_t used;
+    std::size_t peak;         // Most used in any frame so far
+    std::uint64_t failed;     // Requests that did not fit
+
+public:
+    explicit FrameArena(std::size_t capacityBytes = DEFAULT_CAPACITY);
+
+    // nullptr when the frame's share is used up (counted in getFailedCount)
+    void* allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t));
+
+    // Value-initialized array of a type that needs no destructor (e.g. sf::Vertex)
+    template<typename T>
+    T* allocateArray(std::size_t count) {
+        static_assert(std::is_trivially_destructible_v<T>, "arena memory is released without destructors");
+        void* memory = allocate(sizeof(T) * count, alignof(T));
+        if (!memory) return nullptr;
+        T* items = static_cast<T*>(memory);
+        for (std::size_t i = 0; i < count; ++i) new (items + i) T();
+        return items;
+    }
+
+    // printf-style text; truncated to what fits, empty if nothing does
+    std::string_view format(const char* pattern, ...);
+    std::string_view concat(std::string_view first, std::string_view second);
+
+    void reset();
+
+    std::size_t getUsed() const;
+    std::size_t getPeak() const;
+    std::size_t getCapacity() const;
+    std::uint64_t getFailedCount() const;
+};
+
+#endif // FRAMEARENA_H
@@ -0,0 +1,80 @@
+/*
+ * Museum Escape - Frame Profiler Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "FrameProfiler.h"
+#include "MemoryStats.h"
+
+FrameProfiler::FrameProfiler() {
+    reset();
+}
+
+void FrameProfiler::add(FramePhase phase, std::chrono::nanoseconds elapsed, std::uint64_t allocationCount) {
+    std::size_t index = static_cast<std::size_t>(phase);
+    totals[index] += elapsed;
+    allocations[index] += allocationCount;
+    ++samples[index];
+}
+
+void FrameProfiler::reset() {
+    totals.fill(std::chrono::nanoseconds::zero());
+    samples.fill(0);
+    allocations.fill(0);
+}
+
+std::uint64_t FrameProfiler::getSamples(FramePhase phase) const {
+    return samples[static_cast<std::size_t>(phase)];
+}
+
+double FrameProfiler::getTotalMilliseconds(FramePhase phase) const {
+    return std::chrono::duration<double, std::milli>(totals[static_cast<std::size_t>(phase)]).count();
+}
+
+double FrameProfiler::getAverageMicroseconds(FramePhase phase) const {
+    std::uint64_t count = getSamples(phase);
+    if (count == 0) return 0.0;
+    return std::chrono::duration<double, std::micro>(totals[static_cast<std::size_t>(phase)]).count() / count;
+}
+
+std::uint64_t FrameProfiler::getAllocations(FramePhase phase) const {
+    return allocations[static_cast<std::size_t>(phase)];
+}
+
+double FrameProfiler::getAverageAllocations(FramePhase phase) const {
+    std::uint64_t count = getSamples(phase);
+    return count == 0 ? 0.0 : static_cast<double>(getAllocations(phase)) / count;
+}
+
+const char* FrameProfiler::phaseName(FramePhase phase) {
+    switch (phase) {
+        case FramePhase::Frame: return "frame";
+        case FramePhase::Events: return "events";
+        case FramePhase::GuardUpdate: return "guard_update";
+        case FramePhase::GuardDecisions: return "guard_decisions";
+        case FramePhase::Pathfinding: return "pathfinding";
+        case FramePhase::ItemPickup: return "item_pickup";
+        case FramePhase::RoomDraw: return "room_draw";
+        case FramePhase::Hud: return "hud";
+        case FramePhase::DrawQueue: return "draw_queue";
+        case FramePhase::PuzzleDraw: return "puzzle_draw";
+        default: return "unknown";
+    }
+}
+
+// ============================================================================
+// ScopedPhase
+// ============================================================================
+
+ScopedPhase::ScopedPhase(FrameProfiler* target, FramePhase timedPhase)
+    : profiler(target), phase(timedPhase), allocationsAtStart(0) {
+    if (!profiler) return;
+    allocationsAtStart = MemoryStats::allocationCount();
+    start = std::chrono::steady_clock::now();
+}
+
+ScopedPhase::~ScopedPhase() {
+    if (!profiler) return;
+    std::chrono::nanoseconds elapsed = std::chrono::steady_clock::now() - start;
+    profiler->add(phase, elapsed, MemoryStats::allocationCount() - allocationsAtStart);
+}
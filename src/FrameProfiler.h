@@ -0,0 +1,57 @@
+#ifndef FRAMEPROFILER_H
+#define FRAMEPROFILER_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// The parts of a frame worth watching as levels grow. Phases may nest (Frame
+// holds all of them; an item pickup can happen inside Events).
+enum class FramePhase { Frame, Events, GuardUpdate, GuardDecisions, Pathfinding, ItemPickup, RoomDraw, Hud, DrawQueue, PuzzleDraw, Count };
+
+// FrameProfiler - accumulated wall time and heap allocations per phase. The
+// game only carries a pointer to one while something is measuring (--stress,
+// the F3 overlay); otherwise the ScopedPhase markers cost a null check.
+// Allocations come from the process-wide MemoryStats counter, so work other
+// threads do during a phase is counted in it too.
+class FrameProfiler {
+private:
+    static constexpr std::size_t PHASE_COUNT = static_cast<std::size_t>(FramePhase::Count);
+    std::array<std::chrono::nanoseconds, PHASE_COUNT> totals;
+    std::array<std::uint64_t, PHASE_COUNT> samples;
+    std::array<std::uint64_t, PHASE_COUNT> allocations;
+
+public:
+    FrameProfiler();
+
+    void add(FramePhase phase, std::chrono::nanoseconds elapsed, std::uint64_t allocationCount = 0);
+    void reset();
+
+    std::uint64_t getSamples(FramePhase phase) const;
+    double getTotalMilliseconds(FramePhase phase) const;
+    double getAverageMicroseconds(FramePhase phase) const; // Per sample
+    std::uint64_t getAllocations(FramePhase phase) const;
+    double getAverageAllocations(FramePhase phase) const;  // Per sample
+
+    static const char* phaseName(FramePhase phase);
+};
+
+// Times the enclosing scope (and counts its allocations) into a phase; does
+// nothing if profiler is nullptr
+class ScopedPhase {
+private:
+    FrameProfiler* profiler;
+    FramePhase phase;
+    std::chrono::steady_clock::time_point start;
+    std::uint64_t allocationsAtStart;
+
+public:
+    ScopedPhase(FrameProfiler* target, FramePhase timedPhase);
+    ~ScopedPhase();
+
+    ScopedPhase(const ScopedPhase&) = delete;
+    ScopedPhase& operator=(const ScopedPhase&) = delete;
+};
+
+#endif // FRAMEPROFILER_H
@@ -8,18 +8,120 @@
 #include "Puzzle.h"
 #include "Guard.h"
 #include "Item.h"
+#include "DefaultLevel.h"
+#include "ItemID.h"
+#include "RenderStats.h"
+#include "MemoryStats.h"
 #include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
 
-Game::Game() 
+namespace {
+    // Frame time guards' path searches may use; leftover work carries over
+    const std::chrono::microseconds PATH_BUDGET(250);
+    
+    // Frame time for guard decisions (and the sight checks of those that decided)
+    const std::chrono::microseconds AI_BUDGET(200);
+    
+    // At a fixed step (replays, --bench, --stress) the same work comes as a count
+    // instead, so it lands on the same frame on any machine
+    const int FIXED_PATH_EXPANSIONS = 1024;
+    const std::size_t FIXED_AI_TURNS = 32;
+    
+    // Guards give up when the player is more doors ahead than this
+    const std::size_t MAX_FOLLOW_DOORS = 2;
+    
+    // Off-screen rooms handed to each job at a time
+    const std::size_t OFFSCREEN_ROOM_GRAIN = 4;
+    
+    // --stress steps at a fixed rate and moves the player every few frames
+    const std::uint32_t STRESS_RATE = 60;
+    const float STRESS_STEP = 1.0f / STRESS_RATE;
+    const int STRESS_FRAMES_PER_SPOT = 10;
+    
+    // --microbench keeps this many self-rearming timers on its wheel
+    const int WHEEL_BENCH_TIMERS = 1000;
+    
+    // --microbench detects against this many cones at once, enough to go parallel
+    const std::size_t PARALLEL_BENCH_CONES = 1024;
+    
+    // Replays always step at 60 Hz so the same input lands on the same frame
+    const std::uint32_t REPLAY_RATE = 60;
+    
+    // --bench keeps running this long after the last input (victory screen)
+    const std::uint32_t BENCH_TAIL_FRAMES = 60;
+    const double HITCH_MILLISECONDS = 16.7; // One frame at 60 Hz
+    
+    // The F3 overlay averages this many frames per refresh (twice a second)
+    const int OVERLAY_REFRESH_FRAMES = 30;
+    const float OVERLAY_LINE_HEIGHT = 16.0f;
+    const float OVERLAY_BAR_PER_ALLOCATION = 20.0f; // Bar pixels per allocation per frame
+    const float OVERLAY_BAR_MAX = 200.0f;
+    
+    // Notifications slide in from the left unless one is already showing
+    const sf::Vector2f NOTIFICATION_POSITION(50.0f, 50.0f);
+    const float NOTIFICATION_SLIDE = 40.0f;
+    const float NOTIFICATION_SLIDE_SECONDS = 0.2f;
+    
+    // The puzzle cache holds colours already multiplied by their alpha
+    const sf::BlendMode PREMULTIPLIED_ALPHA(sf::BlendMode::Factor::One, sf::BlendMode::Factor::OneMinusSrcAlpha);
+    
+    // Whether anything drawn under the image could show through it
+    bool isOpaque(const sf::Image& image) {
+        const std::uint8_t* pixels = image.getPixelsPtr();
+        std::size_t count = static_cast<std::size_t>(image.getSize().x) * image.getSize().y;
+        for (std::size_t i = 0; i < count; ++i) {
+            if (pixels[i * 4 + 3] != 255) return false;
+        }
+        return count > 0;
+    }
+    
+    // MM:SS.mmm, truncated to the millisecond
+    std::string formatRunTime(std::chrono::nanoseconds time) {
+        long long milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(time).count();
+        FixedText<24> text;
+        text.appendNumber(static_cast<long>(milliseconds / 60000), 2).append(":")
+            .appendNumber(static_cast<long>(milliseconds / 1000 % 60), 2).append(".")
+            .appendNumber(static_cast<long>(milliseconds % 1000), 3);
+        return std::string(text.view());
+    }
+    
+    // Nearest-rank percentile of sorted samples
+    double percentile(const std::vector<double>& sorted, double fraction) {
+        if (sorted.empty()) return 0.0;
+        std::size_t rank = static_cast<std::size_t>(std::ceil(fraction * sorted.size()));
+        return sorted[std::min(sorted.size(), std::max<std::size_t>(rank, 1)) - 1];
+    }
+}
+
+Game::Game(const std::string& levelFile) 
     : window(sf::VideoMode({800u, 600u}), "Museum Escape - Enhanced"),
       currentState(GameState::MENU),
       deltaTime(0.0f),
+      levelPath(levelFile),
       currentRoomID(1),
+      currentRoom(nullptr),
       activePuzzle(nullptr),
+      roomEnteredAt(GameClock::Duration::zero()),
       stateText(defaultFont),
+      roomNameText(defaultFont),
       notificationText(notificationFont),
-      notificationTimer(0.0f),
-      notificationColor(sf::Color::White)
+      notificationVisible(false),
+      notificationExpiry(NO_TIMER),
+      puzzleCacheReady(false),
+      puzzleCacheDirty(true),
+      profiler(nullptr),
+      debugOverlayVisible(false),
+      overlayFrames(0),
+      overlayAllocations{},
+      debugText(defaultFont),
+      overdrawHeatmap(false),
+      playback(nullptr),
+      recording(nullptr),
+      frameNumber(0)
 {
     window.setFramerateLimit(60);
     initialize();
@@ -28,24 +130,38 @@ Game::Game()
 Game::~Game() {}
 
 void Game::initialize() {
+    loadLevelData();
     loadAssets();
-    player = std::make_unique<Player>(100.0f, 100.0f, playerTexture);
-    gameTimer = std::make_unique<Timer>(600.0f);
+    const LevelView& data = level.getView();
+    currentRoomID = data.startRoomID;
+    player = std::make_unique<Player>(data.startX, data.startY, playerTexture);
+    gameTimer = std::make_unique<Timer>(timers, 600.0f);
     gameTimer->setDisplayPosition(650.0f, 20.0f);
     gameTimer->setFont(mainFont);
+    gameTimer->setExpiryCallback([this]() { events.publish(TimerExpired{}); });
+    ruleEngine.connect(events, [this](const GameRule& rule, int roomID) { applyRule(rule, roomID); });
     inventory = std::make_unique<Inventory>(15);
     inventory->setFont(mainFont);
-    createRooms();
-    setupPuzzles();
+    loadLevel();
     stateText.setFont(mainFont);
     stateText.setCharacterSize(30);
     stateText.setFillColor(sf::Color::White);
     stateText.setPosition({250.0f, 250.0f});
-    notificationText.setFont(mainFont);
-    notificationText.setCharacterSize(24);
-    notificationText.setPosition({50.0f, 50.0f});
-    notificationText.setOutlineThickness(2.0f);
-    notificationText.setOutlineColor(sf::Color::Black);
+    notificationText.getText().setFont(mainFont);
+    notificationText.getText().setCharacterSize(24);
+    notificationText.getText().setPosition(NOTIFICATION_POSITION);
+    notificationText.getText().setOutlineThickness(2.0f);
+    notificationText.getText().setOutlineColor(sf::Color::Black);
+    roomNameText.getText().setFont(mainFont);
+    roomNameText.getText().setCharacterSize(18);
+    roomNameText.getText().setPosition({10.0f, 10.0f});
+    debugText.setFont(mainFont);
+    debugText.setCharacterSize(13);
+    debugText.setPosition({10.0f, 40.0f});
+    debugText.setOutlineThickness(1.0f);
+    debugText.setOutlineColor(sf::Color::Black);
+    puzzleCacheReady = puzzleCache.resize({800u, 600u});
+    if (!puzzleCacheReady) std::cerr << "Warning: no puzzle cache, puzzles draw directly" << std::endl;
     overlay.setSize({800.0f, 600.0f});
     overlay.setFillColor(sf::Color(0, 0, 0, 150));
     std::cout << "Game initialized successfully!" << std::endl;
@@ -59,155 +175,548 @@ void Game::loadAssets() {
     
     if (!fontLoaded) std::cerr << "Warning: Could not load font!" << std::endl;
     
-    if (!playerTexture.loadFromFile("assets/player.png")) std::cerr << "Failed: assets/player.png" << std::endl;
-    if (!guardTexture.loadFromFile("assets/guard.png")) std::cerr << "Failed: assets/guard.png" << std::endl;
+    // === DECODE IMAGES === (PNG decoding is CPU work and runs on every core;
+    // creating the textures needs the GL context, so that stays on this thread)
+    const LevelView& data = level.getView();
+    std::vector<std::string> imagePaths = {"assets/player.png", "assets/guard.png"};
+    for (std::uint32_t i = 0; i < data.roomCount; ++i) {
+        imagePaths.push_back(data.rooms[i].texture);       // Normal background
+        imagePaths.push_back(data.rooms[i].solvedTexture); // Open background (e.g. room1_open.png)
+    }
+    std::vector<sf::Image> images(imagePaths.size());
+    std::vector<std::uint8_t> decoded(imagePaths.size(), 0);
+    std::vector<std::uint8_t> opaque(imagePaths.size(), 0);
+    jobs.parallelFor(imagePaths.size(), 1, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            decoded[i] = !imagePaths[i].empty() && images[i].loadFromFile(imagePaths[i]);
+            opaque[i] = decoded[i] && isOpaque(images[i]);
+        }
+    });
+    
+    if (!decoded[0] || !playerTexture.loadFromImage(images[0])) std::cerr << "Failed: assets/player.png" << std::endl;
+    if (!decoded[1] || !guardTexture.loadFromImage(images[1])) std::cerr << "Failed: assets/guard.png" << std::endl;
     
-    // === LOAD ROOM TEXTURES ===
-    for (int i = 1; i <= 7; ++i) {
-        // Normal Background
+    // === LOAD ROOM TEXTURES === (indexed by room ID; sized once so rooms can keep pointers)
+    int maxRoomID = 0;
+    for (std::uint32_t i = 0; i < data.roomCount; ++i) maxRoomID = std::max(maxRoomID, data.rooms[i].id);
+    roomTextures.assign(maxRoomID + 1, std::nullopt);
+    solvedRoomTextures.assign(maxRoomID + 1, std::nullopt);
+    solvedRoomOpaque.assign(maxRoomID + 1, 0);
+    
+    for (std::uint32_t i = 0; i < data.roomCount; ++i) {
+        const RoomDef& def = data.rooms[i];
+        std::size_t normal = 2 + 2 * i;
+        std::size_t open = normal + 1;
+        
         sf::Texture texture;
-        std::string filenamePNG = "assets/room" + std::to_string(i) + ".png";
-        if (texture.loadFromFile(filenamePNG)) {
-            roomTextures[i] = texture;
-            std::cout << "Loaded: " << filenamePNG << std::endl;
+        if (decoded[normal] && texture.loadFromImage(images[normal])) {
+            roomTextures[def.id] = std::move(texture);
+            std::cout << "Loaded: " << def.texture << std::endl;
         }
         
-        // Open Background (e.g. room1_open.png)
         sf::Texture openTexture;
-        std::string openFilename = "assets/room" + std::to_string(i) + "_open.png";
-        if (openTexture.loadFromFile(openFilename)) {
-            solvedRoomTextures[i] = openTexture;
-            std::cout << "Loaded: " << openFilename << std::endl;
+        if (decoded[open] && openTexture.loadFromImage(images[open])) {
+            solvedRoomTextures[def.id] = std::move(openTexture);
+            solvedRoomOpaque[def.id] = opaque[open];
+            std::cout << "Loaded: " << def.solvedTexture << std::endl;
         }
     }
 }
 
+// Find the level: explicit path, then assets/museum.lvlc, then the built-in museum
+void Game::loadLevelData() {
+    if (!levelPath.empty()) {
+        if (level.loadFromFile(levelPath)) {
+            std::cout << "Loaded level: " << levelPath << std::endl;
+            return;
+        }
+        std::cerr << "Warning: " << level.getError() << std::endl;
+    }
+    
+    // A cooked museum in assets/ overrides the compiled-in one. Only the compiled-in
+    // tables are checked at build time; the file gets Level::validate on load.
+    if (level.loadFromFile("assets/museum.lvlc")) {
+        std::cout << "Loaded level: assets/museum.lvlc" << std::endl;
+        return;
+    }
+    
+    level.useStatic(DEFAULT_MUSEUM_LEVEL);
+}
+
 void Game::createRooms() {
-    // Room Creation
-    auto room1 = std::make_shared<Room>(1, "Main Entrance", 0, 0, 800, 600);
-    room1->addItem(std::make_shared<Tool>("Flashlight", "flashlight", "Illuminates dark areas", 150.0f, 150.0f));
-    room1->addItem(std::make_shared<BasicItem>("Museum Map", "Map of museum", 650.0f, 150.0f));
-    auto guard1 = std::make_shared<Guard>(400.0f, 200.0f, 100.0f, guardTexture);
-    guard1->addPatrolPoint(400.0f, 200.0f); guard1->addPatrolPoint(600.0f, 200.0f);
-    room1->addGuard(guard1);
-    rooms[1] = room1;
-    
-    auto room2 = std::make_shared<Room>(2, "Ancient Artifacts Gallery", 0, 0, 800, 600);
-    auto guard2 = std::make_shared<Guard>(400.0f, 450.0f, 110.0f, guardTexture);
-    guard2->addPatrolPoint(400.0f, 450.0f); guard2->addPatrolPoint(400.0f, 150.0f);
-    room2->addGuard(guard2);
-    rooms[2] = room2;
-    
-    auto room3 = std::make_shared<Room>(3, "Medieval Weapons Hall", 0, 0, 800, 600);
-    room3->addItem(std::make_shared<Tool>("Bolt Cutters", "bolt_cutters", "Cuts chains", 650.0f, 500.0f));
-    room3->addItem(std::make_shared<BasicItem>("Red Keycard", "Security card", 150.0f, 150.0f));
-    auto guard3 = std::make_shared<Guard>(400.0f, 200.0f, 100.0f, guardTexture);
-    guard3->addPatrolPoint(400.0f, 200.0f); guard3->addPatrolPoint(600.0f, 200.0f);
-    room3->addGuard(guard3);
-    rooms[3] = room3;
-    
-    auto room4 = std::make_shared<Room>(4, "Security Control Room", 0, 0, 800, 600);
-    room4->addItem(std::make_shared<Passcode>("Access Code Note", "4738", 150.0f, 500.0f));
-    auto guard4a = std::make_shared<Guard>(300.0f, 150.0f, 110.0f, guardTexture);
-    guard4a->addPatrolPoint(300.0f, 150.0f); guard4a->addPatrolPoint(600.0f, 150.0f);
-    room4->addGuard(guard4a);
-    auto guard4b = std::make_shared<Guard>(600.0f, 450.0f, 110.0f, guardTexture);
-    guard4b->addPatrolPoint(600.0f, 450.0f); guard4b->addPatrolPoint(300.0f, 450.0f);
-    room4->addGuard(guard4b);
-    rooms[4] = room4;
-    
-    auto room5 = std::make_shared<Room>(5, "Dark Archives", 0, 0, 800, 600);
-    room5->addItem(std::make_shared<BasicItem>("Encrypted Note", "Wire sequence", 650.0f, 150.0f));
-    auto guard5 = std::make_shared<Guard>(400.0f, 400.0f, 120.0f, guardTexture);
-    guard5->addPatrolPoint(400.0f, 400.0f); guard5->addPatrolPoint(600.0f, 400.0f);
-    room5->addGuard(guard5);
-    rooms[5] = room5;
-    
-    auto room6 = std::make_shared<Room>(6, "Laboratory", 0, 0, 800, 600);
-    room6->addItem(std::make_shared<BasicItem>("Evidence Log", "Illegal experiments", 150.0f, 150.0f));
-    auto guard6a = std::make_shared<Guard>(400.0f, 200.0f, 115.0f, guardTexture);
-    guard6a->addPatrolPoint(400.0f, 200.0f); guard6a->addPatrolPoint(600.0f, 200.0f);
-    room6->addGuard(guard6a);
-    auto guard6b = std::make_shared<Guard>(600.0f, 450.0f, 115.0f, guardTexture);
-    guard6b->addPatrolPoint(600.0f, 450.0f); guard6b->addPatrolPoint(400.0f, 450.0f);
-    room6->addGuard(guard6b);
-    rooms[6] = room6;
-    
-    auto room7 = std::make_shared<Room>(7, "Director's Office", 0, 0, 800, 600);
-    room7->addItem(std::make_shared<BasicItem>("Evidence File", "The proof!", 400.0f, 300.0f));
-    room7->setExitRoom(true);
-    rooms[7] = room7;
+    const LevelView& data = level.getView();
+    
+    for (std::uint32_t i = 0; i < data.roomCount; ++i) {
+        const RoomDef& def = data.rooms[i];
+        Room* room = levelArena.create<Room>(def.id, def.name, def.x, def.y, def.width, def.height);
+        room->setExitRoom(def.isExit != 0);
+        room->setTweenSystem(&tweens);
+        rooms.add(room);
+    }
+    
+    for (std::uint32_t i = 0; i < data.wallCount; ++i) {
+        const WallDef& def = data.walls[i];
+        rooms.find(def.roomID)->getCollisionMap().addSolidRect(sf::FloatRect({def.x, def.y}, {def.width, def.height}));
+    }
+    
+    for (std::uint32_t i = 0; i < data.itemCount; ++i) {
+        const ItemDef& def = data.items[i];
+        Item* item = nullptr;
+        switch (def.type) {
+            case ItemDefType::Basic: item = levelArena.create<BasicItem>(def.name, def.detail, def.x, def.y); break;
+            case ItemDefType::Key: item = levelArena.create<Key>(def.name, def.detail, def.x, def.y); break;
+            case ItemDefType::Passcode: item = levelArena.create<Passcode>(def.name, def.detail, def.x, def.y); break;
+            case ItemDefType::Tool: item = levelArena.create<Tool>(def.name, def.detail, def.extra, def.x, def.y); break;
+        }
+        rooms.find(def.roomID)->addItem(item);
+    }
+    
+    for (std::uint32_t i = 0; i < data.guardCount; ++i) {
+        const GuardDef& def = data.guards[i];
+        Guard* guard = levelArena.create<Guard>(def.x, def.y, def.detectionRange, guardTexture);
+        for (std::uint32_t p = 0; p < def.patrolPointCount; ++p) {
+            const PatrolPointDef& point = data.patrolPoints[def.firstPatrolPoint + p];
+            guard->addPatrolPoint(point.x, point.y);
+        }
+        Room* room = rooms.find(def.roomID);
+        guard->setCollisionMap(&room->getCollisionMap());
+        guard->setPathScheduler(&pathScheduler);
+        guard->setTimerWheel(&timers);
+        room->addGuard(guard);
+    }
     
     // Doors (Invisible)
-    room1->addDoor(std::make_shared<Door>(750.0f, 300.0f, 2));
-    room2->addDoor(std::make_shared<Door>(50.0f, 300.0f, 1));
-    room2->addDoor(std::make_shared<Door>(750.0f, 300.0f, 3, true, "blue_keycard"));
-    room3->addDoor(std::make_shared<Door>(50.0f, 300.0f, 2));
-    room3->addDoor(std::make_shared<Door>(750.0f, 300.0f, 4));
-    room4->addDoor(std::make_shared<Door>(50.0f, 300.0f, 3));
-    room4->addDoor(std::make_shared<Door>(750.0f, 300.0f, 5, true, "yellow_keycard"));
-    room5->addDoor(std::make_shared<Door>(50.0f, 300.0f, 4));
-    room5->addDoor(std::make_shared<Door>(750.0f, 300.0f, 6, true, "green_keycard"));
-    room6->addDoor(std::make_shared<Door>(50.0f, 300.0f, 5));
-    room6->addDoor(std::make_shared<Door>(750.0f, 300.0f, 7, true, "master_keycard"));
-    room7->addDoor(std::make_shared<Door>(50.0f, 300.0f, 6));
+    for (std::uint32_t i = 0; i < data.doorCount; ++i) {
+        const DoorDef& def = data.doors[i];
+        bool locked = def.requiredKey[0] != '\0';
+        rooms.find(def.roomID)->addDoor(levelArena.create<Door>(def.x, def.y, def.targetRoomID, locked, def.requiredKey));
+    }
     
     // === APPLY TEXTURES ===
-    for (auto& pair : rooms) {
-        int id = pair.first;
-        if (roomTextures.find(id) != roomTextures.end()) {
-            pair.second->setBackgroundTexture(roomTextures[id]);
+    for (Room* room : rooms) {
+        std::size_t id = static_cast<std::size_t>(room->getRoomID());
+        if (id < roomTextures.size() && roomTextures[id]) {
+            room->setBackgroundTexture(*roomTextures[id]);
         }
-        if (solvedRoomTextures.find(id) != solvedRoomTextures.end()) {
-            pair.second->setSolvedBackgroundTexture(solvedRoomTextures[id]);
+        if (id < solvedRoomTextures.size() && solvedRoomTextures[id]) {
+            room->setSolvedBackgroundTexture(*solvedRoomTextures[id], solvedRoomOpaque[id] != 0);
         }
     }
 }
 
-void Game::setupPuzzles() {
-    auto patternPuzzle = std::make_shared<PatternPuzzle>(std::vector<int>{1, 3, 2, 4});
-    patternPuzzle->setFont(mainFont);
-    rooms[2]->addPuzzle(patternPuzzle);
-    
-    auto riddle = std::make_shared<RiddlePuzzle>("I speak without a mouth...", "echo");
-    riddle->setFont(mainFont);
-    rooms[3]->addPuzzle(riddle);
+// (Re)build the level - the previous one is released in a single arena reset
+void Game::loadLevel() {
+    activePuzzle = nullptr;
+    currentRoom = nullptr;
+    pathScheduler.clear(); // Guards own the queued searches
+    followingGuards.clear();
+    aiScheduler.reset();
+    rooms.clear();
+    inventory->clear();
+    player->getInventory().clear();
+    timers.clear(); // Callbacks point into the level (the game timer is reset first)
+    tweens.clear();
+    notificationVisible = false;
+    levelArena.reset();
+    puzzles.clear();
+    events.clearQueue();
     
-    auto lockPuzzle = std::make_shared<LockPuzzle>("4738");
-    lockPuzzle->setFont(mainFont);
-    rooms[4]->addPuzzle(lockPuzzle);
+    createRooms();
+    setupPuzzles();
+    rooms.buildDoorGraph();
+    roomRouter.build(rooms);
+    currentRoom = rooms.find(currentRoomID);
+    refreshRoomName();
+    ruleEngine.setRules(level.getView().rules, level.getView().ruleCount);
+}
+
+void Game::setupPuzzles() {
+    const LevelView& data = level.getView();
     
-    auto mathPuzzle = std::make_shared<MathPuzzle>("(60 - 12) = ?", "048");
-    mathPuzzle->setFont(mainFont);
-    rooms[5]->addPuzzle(mathPuzzle);
+    // Puzzle texts point at fonts inside the puzzle, so the array must never reallocate
+    puzzles.reserve(data.puzzleCount);
     
-    auto wirePuzzle = std::make_shared<WirePuzzle>(std::vector<std::string>{"Red", "Yellow", "Blue", "Green", "Purple"});
-    wirePuzzle->setFont(mainFont);
-    wirePuzzle->setBoltCutters(false);
-    rooms[6]->addPuzzle(wirePuzzle);
+    for (std::uint32_t i = 0; i < data.puzzleCount; ++i) {
+        const PuzzleDef& def = data.puzzles[i];
+        
+        switch (def.type) {
+            case PuzzleType::Pattern: {
+                std::vector<int> pattern;
+                for (const char* c = def.answer; *c; ++c) pattern.push_back(*c - '0');
+                puzzles.emplace_back(std::in_place_type<PatternPuzzle>, pattern);
+                break;
+            }
+            case PuzzleType::Riddle:
+                puzzles.emplace_back(std::in_place_type<RiddlePuzzle>, def.text, def.answer);
+                break;
+            case PuzzleType::Lock:
+                puzzles.emplace_back(std::in_place_type<LockPuzzle>, def.answer);
+                break;
+            case PuzzleType::Math:
+                puzzles.emplace_back(std::in_place_type<MathPuzzle>, def.text, def.answer);
+                break;
+            case PuzzleType::Wire: {
+                std::vector<std::string> sequence;
+                std::string colors = def.answer;
+                std::size_t start = 0;
+                while (start <= colors.size()) {
+                    std::size_t comma = colors.find(',', start);
+                    if (comma == std::string::npos) comma = colors.size();
+                    sequence.push_back(colors.substr(start, comma - start));
+                    start = comma + 1;
+                }
+                puzzles.emplace_back(std::in_place_type<WirePuzzle>, sequence);
+                std::get<WirePuzzle>(puzzles.back()).setBoltCutters(false);
+                break;
+            }
+        }
+        
+        PuzzleVariant& puzzle = puzzles.back();
+        std::visit([this](auto& p) { p.setFont(mainFont); }, puzzle);
+        rooms.find(def.roomID)->addPuzzle(&puzzle);
+    }
 }
 
 void Game::run() {
     while (window.isOpen()) {
-        deltaTime = clock.restart().asSeconds();
-        if (deltaTime > 0.1f) deltaTime = 0.1f;
+        clock.tick();
+        deltaTime = clock.getStepSeconds();
+        {
+            ScopedPhase framePhase(profiler, FramePhase::Frame);
+            processEvents();
+            update();
+            render();
+        }
+        ++frameNumber;
+        if (debugOverlayVisible) refreshDebugOverlay();
+    }
+}
+
+void Game::record(Replay& replay) {
+    recording = &replay;
+    frameNumber = 0;
+    clock.setFixedRate(REPLAY_RATE);
+    run();
+    clock.setFixedRate(0);
+    recording = nullptr;
+}
+
+bool Game::runBench(Replay& session, const std::string& reportPath) {
+    using Clock = std::chrono::steady_clock;
+    session.rewind();
+    playback = &session;
+    frameNumber = 0;
+    clock.setFixedRate(REPLAY_RATE);
+    window.setFramerateLimit(0); // Time the work, not the frame cap
+    
+    std::uint32_t endFrame = session.getLastFrame() + BENCH_TAIL_FRAMES;
+    std::vector<double> frameMilliseconds;
+    frameMilliseconds.reserve(endFrame + 1);
+    std::uint64_t totalDraws = 0, maxDraws = 0;
+    std::uint64_t totalVertices = 0, totalBinds = 0, totalCulled = 0, totalSaved = 0;
+    double totalOverdraw = 0.0;
+    std::uint64_t totalAllocations = 0, maxAllocations = 0;
+    std::uint64_t bytesBefore = MemoryStats::allocatedBytes();
+    
+    while (window.isOpen() && frameNumber <= endFrame) {
+        std::uint64_t allocationsBefore = MemoryStats::allocationCount();
+        Clock::time_point start = Clock::now();
+        
+        clock.tick();
+        deltaTime = clock.getStepSeconds();
         processEvents();
         update();
         render();
+        
+        std::chrono::duration<double, std::milli> elapsed = Clock::now() - start;
+        std::uint64_t allocations = MemoryStats::allocationCount() - allocationsBefore;
+        frameMilliseconds.push_back(elapsed.count());
+        totalDraws += RenderStats::frame.drawCalls;
+        maxDraws = std::max(maxDraws, RenderStats::frame.drawCalls);
+        totalVertices += RenderStats::frame.vertices;
+        totalBinds += RenderStats::frame.textureBinds;
+        totalCulled += RenderStats::frame.culled;
+        totalSaved += RenderStats::frame.stateChangesSaved;
+        totalOverdraw += RenderStats::overdraw(window);
+        totalAllocations += allocations;
+        maxAllocations = std::max(maxAllocations, allocations);
+        ++frameNumber;
+    }
+    playback = nullptr;
+    clock.setFixedRate(0);
+    window.setFramerateLimit(60);
+    
+    bool completed = currentState == GameState::VICTORY;
+    std::size_t frames = frameMilliseconds.size();
+    double meanMilliseconds = 0.0;
+    std::size_t hitches = 0;
+    for (double milliseconds : frameMilliseconds) {
+        meanMilliseconds += milliseconds;
+        if (milliseconds > HITCH_MILLISECONDS) ++hitches;
+    }
+    if (frames > 0) meanMilliseconds /= frames;
+    std::sort(frameMilliseconds.begin(), frameMilliseconds.end());
+    double perFrame = frames > 0 ? 1.0 / frames : 0.0;
+    
+    std::ofstream out(reportPath, std::ios::binary);
+    out << std::fixed << std::setprecision(3)
+        << "{\n  \"frames\": " << frames
+        << ",\n  \"completed\": " << (completed ? "true" : "false")
+        << ",\n  \"frame_ms\": {\"p50\": " << percentile(frameMilliseconds, 0.50)
+        << ", \"p95\": " << percentile(frameMilliseconds, 0.95)
+        << ", \"p99\": " << percentile(frameMilliseconds, 0.99)
+        << ", \"max\": " << (frames > 0 ? frameMilliseconds.back() : 0.0)
+        << ", \"mean\": " << meanMilliseconds << "}"
+        << ",\n  \"hitches_over_16_7ms\": " << hitches
+        << ",\n  \"draw_calls\": {\"total\": " << totalDraws << ", \"per_frame_avg\": " << totalDraws * perFrame
+        << ", \"per_frame_max\": " << maxDraws << "}"
+        << ",\n  \"render\": {\"vertices_per_frame\": " << totalVertices * perFrame
+        << ", \"texture_binds_per_frame\": " << totalBinds * perFrame
+        << ", \"culled_per_frame\": " << totalCulled * perFrame
+        << ", \"state_changes_saved_per_frame\": " << totalSaved * perFrame
+        << ", \"overdraw_avg\": " << totalOverdraw * perFrame << "}"
+        << ",\n  \"allocations\": {\"total\": " << totalAllocations << ", \"per_frame_avg\": " << totalAllocations * perFrame
+        << ", \"per_frame_max\": " << maxAllocations << ", \"bytes\": " << MemoryStats::allocatedBytes() - bytesBefore << "}"
+        << ",\n  \"peak_rss_bytes\": " << MemoryStats::peakResidentBytes()
+        << ",\n  \"game_time_ns\": " << clock.getGameTime().count() << ",\n  \"room_splits_ns\": [";
+    for (std::size_t i = 0; i < roomSplits.size(); ++i) out << (i ? ", " : "") << roomSplits[i].time.count();
+    out << "]\n}\n";
+    if (!out) {
+        std::cerr << "Error: cannot write " << reportPath << std::endl;
+        return false;
+    }
+    
+    std::cout << "Bench: " << frames << " frames, p50 " << percentile(frameMilliseconds, 0.50) << " ms, p99 "
+              << percentile(frameMilliseconds, 0.99) << " ms, " << hitches << " hitches, "
+              << totalDraws * perFrame << " draws/frame, " << totalAllocations * perFrame << " allocs/frame" << std::endl;
+    if (!completed) std::cerr << "Warning: the session did not reach victory - re-record it" << std::endl;
+    return completed;
+}
+
+void Game::runStress(int framesPerRoom) {
+    FrameProfiler stats;
+    profiler = &stats;
+    clock.setFixedRate(STRESS_RATE);
+    window.setFramerateLimit(0); // Time the work, not the frame cap
+    currentState = GameState::PLAYING;
+    gameTimer->start();
+    
+    std::size_t guardCount = 0;
+    std::size_t itemCount = 0;
+    for (Room* room : rooms) {
+        guardCount += room->getGuards().size();
+        itemCount += room->getItems().size();
+    }
+    
+    // Rooms in table order; walks between them are skipped, the player just appears
+    for (std::size_t slot = 0; slot < rooms.size() && window.isOpen(); ++slot) {
+        Room* room = rooms.at(static_cast<int>(slot));
+        if (room != currentRoom) changeRoom(room->getRoomID());
+        
+        // Stand on each item in turn so pickups (and the inventory) see real work
+        std::size_t spot = 0;
+        for (int frame = 0; frame < framesPerRoom && window.isOpen(); ++frame) {
+            ScopedPhase framePhase(profiler, FramePhase::Frame);
+            const std::vector<Item*>& items = currentRoom->getItems();
+            if (frame % STRESS_FRAMES_PER_SPOT == 0 && !items.empty()) {
+                sf::Vector2f at = items[spot++ % items.size()]->getPosition();
+                player->setPosition(at.x, at.y);
+            }
+            clock.tick();
+            deltaTime = clock.getStepSeconds();
+            processEvents();
+            update();
+            checkItemPickup();
+            render();
+            
+            // Detection rules may end the run early; the measurement carries on
+            if (currentState != GameState::PLAYING) currentState = GameState::PLAYING;
+        }
+    }
+    profiler = nullptr;
+    clock.setFixedRate(0);
+    window.setFramerateLimit(60);
+    
+    std::cout << "Stress run: " << rooms.size() << " rooms, " << guardCount << " guards, "
+              << itemCount << " items, " << jobs.getThreadCount() << " threads" << std::endl;
+    std::cout << std::left << std::setw(18) << "phase" << std::right << std::setw(10) << "samples"
+              << std::setw(14) << "avg (us)" << std::setw(14) << "total (ms)" << std::setw(14) << "allocs/call" << std::endl;
+    for (std::size_t i = 0; i < static_cast<std::size_t>(FramePhase::Count); ++i) {
+        FramePhase phase = static_cast<FramePhase>(i);
+        std::cout << std::left << std::setw(18) << FrameProfiler::phaseName(phase) << std::right
+                  << std::setw(10) << stats.getSamples(phase)
+                  << std::setw(14) << std::fixed << std::setprecision(2) << stats.getAverageMicroseconds(phase)
+                  << std::setw(14) << stats.getTotalMilliseconds(phase)
+                  << std::setw(14) << stats.getAverageAllocations(phase) << std::endl;
+    }
+}
+
+void Game::runMicroBenchmarks(MicroBench& bench) {
+    sf::RenderTexture canvas;
+    if (!canvas.resize({800u, 600u})) {
+        std::cerr << "Warning: no offscreen target, skipping draw benchmarks" << std::endl;
+    }
+    bool canDraw = canvas.getSize().x > 0;
+    
+    // === GUARDS === (the first room with any)
+    Room* guardRoom = currentRoom;
+    for (Room* room : rooms) {
+        if (guardRoom && !guardRoom->getGuards().empty()) break;
+        guardRoom = room;
+    }
+    if (guardRoom && !guardRoom->getGuards().empty()) {
+        Guard* guard = guardRoom->getGuards().front();
+        bench.measure("guard_patrol", [&]() { guard->patrol(STRESS_STEP); });
+        
+        // Detection is a vision cone plus line of sight (Guard::detectPlayer's replacement)
+        const CollisionMap& map = guardRoom->getCollisionMap();
+        sf::Vector2f target = guard->getCenter() + sf::Vector2f(40.0f, 0.0f);
+        std::uint8_t seen = 0;
+        bench.measure("guard_detect", [&]() {
+            VisionCone cone = guard->getVisionCone();
+            detectInBatch(map, &cone, 1, target, &seen);
+            bench.consume(seen);
+        });
+        
+        std::vector<VisionCone> cones;
+        for (Guard* roomGuard : guardRoom->getGuards()) cones.push_back(roomGuard->getVisionCone());
+        std::vector<std::uint8_t> hits(cones.size());
+        bench.measure("guard_detect_room_batch", [&]() {
+            detectInBatch(map, cones.data(), cones.size(), target, hits.data(), &jobs);
+            bench.consume(hits[0]);
+        });
+        
+        // Big enough to be split across the job system (several BATCH_GRAINs)
+        std::vector<VisionCone> crowd;
+        while (crowd.size() < PARALLEL_BENCH_CONES) crowd.insert(crowd.end(), cones.begin(), cones.end());
+        std::vector<std::uint8_t> crowdHits(crowd.size());
+        bench.measure("guard_detect_parallel_batch", [&]() {
+            detectInBatch(map, crowd.data(), crowd.size(), target, crowdHits.data(), &jobs);
+            bench.consume(crowdHits[0]);
+        });
+    }
+    
+    // === OFF-SCREEN ROOMS === (one frame of their patrols, spread over the job system)
+    deltaTime = STRESS_STEP;
+    bench.measure("offscreen_rooms_update", [&]() { updateOffscreenRooms(); });
+    
+    // === ITEM PICKUP === (standing where nothing is, so items stay in place)
+    if (currentRoom) {
+        player->setPosition(-1000.0f, -1000.0f);
+        bench.measure("game_check_item_pickup", [&]() { checkItemPickup(); });
+    }
+    
+    // === INVENTORY ===
+    Inventory bag(15);
+    std::vector<std::unique_ptr<Item>> bagItems;
+    for (int i = 0; i < 12; ++i) {
+        bagItems.push_back(std::make_unique<BasicItem>("Artifact " + std::to_string(i), "Bench item", 0.0f, 0.0f));
+    }
+    bagItems.push_back(std::make_unique<Tool>("Flashlight", "flashlight", "Bench tool", 0.0f, 0.0f));
+    for (auto& item : bagItems) bag.addItem(item.get());
+    ItemID heldID = bagItems[5]->getID();
+    bench.measure("inventory_has_item_id", [&]() { bench.consume(bag.hasItem(heldID)); });
+    bench.measure("inventory_has_item_name", [&]() { bench.consume(bag.hasItem("Artifact 7")); });
+    bench.measure("inventory_has_tool_name", [&]() { bench.consume(bag.hasTool("bolt_cutters")); });
+    bench.measure("inventory_has_tool_type", [&]() { bench.consume(bag.hasTool(ToolType::Flashlight)); });
+    
+    // === TIMERS ===
+    // One frame of a busy wheel: WHEEL_BENCH_TIMERS cooldowns that re-arm when they fire
+    TimerWheel wheel;
+    const TimerWheel::Duration frame(1000000000 / STRESS_RATE);
+    std::function<void()> rearm = [&]() { wheel.schedule(std::chrono::seconds(2), rearm); };
+    for (int i = 0; i < WHEEL_BENCH_TIMERS; ++i) wheel.schedule(std::chrono::milliseconds(i * 2000 / WHEEL_BENCH_TIMERS), rearm);
+    bench.measure("timer_wheel_frame", [&]() { wheel.advance(frame); });
+    bench.measure("timer_wheel_schedule_cancel", [&]() {
+        bench.consume(wheel.cancel(wheel.schedule(std::chrono::seconds(5), nullptr)));
+    });
+    
+    Timer timer(wheel, 600.0f);
+    timer.setFont(mainFont);
+    timer.start();
+    bench.measure("timer_formatted_time", [&]() { bench.consume(timer.getFormattedTime().size()); });
+    
+    // === PUZZLES === (private copies with answers the input script never types)
+    std::vector<PuzzleVariant> benchPuzzles;
+    benchPuzzles.reserve(5); // Texts point at fonts inside the puzzles
+    benchPuzzles.emplace_back(std::in_place_type<RiddlePuzzle>, "What has keys but opens no locks?", "piano");
+    benchPuzzles.emplace_back(std::in_place_type<PatternPuzzle>, std::vector<int>{1, 2, 3, 4});
+    benchPuzzles.emplace_back(std::in_place_type<LockPuzzle>, "1234");
+    benchPuzzles.emplace_back(std::in_place_type<MathPuzzle>, "6 x 7 = ?", "42");
+    benchPuzzles.emplace_back(std::in_place_type<WirePuzzle>, std::vector<std::string>{"Red", "Blue", "Green"});
+    const char* puzzleNames[] = { "riddle", "pattern", "lock", "math", "wire" };
+    
+    // Type a digit, delete it, click mid-screen, press R - cycles without ever solving
+    sf::Event script[] = {
+        sf::Event::TextEntered{U'7'},
+        sf::Event::TextEntered{U'\b'},
+        sf::Event::KeyPressed{sf::Keyboard::Key::Backspace},
+        sf::Event::MouseButtonPressed{sf::Mouse::Button::Left, {400, 300}},
+        sf::Event::KeyPressed{sf::Keyboard::Key::R},
+    };
+    const std::size_t scriptLength = sizeof(script) / sizeof(script[0]);
+    
+    for (std::size_t i = 0; i < benchPuzzles.size(); ++i) {
+        PuzzleVariant& puzzle = benchPuzzles[i];
+        std::visit([this](auto& p) { p.setFont(mainFont); }, puzzle);
+        std::string name = puzzleNames[i];
+        
+        std::size_t step = 0;
+        bench.measure("puzzle_" + name + "_handle_input", [&]() {
+            std::visit([&](auto& p) { p.handleInput(script[step]); }, puzzle);
+            if (++step == scriptLength) step = 0;
+        });
+        if (canDraw) {
+            bench.measure("puzzle_" + name + "_display", [&]() {
+                std::visit([&](auto& p) { p.display(canvas); }, puzzle);
+            });
+        }
+    }
+    
+    // === ROOM ===
+    if (canDraw && currentRoom) {
+        bench.measure("room_draw", [&]() {
+            currentRoom->draw(renderQueue);
+            renderQueue.flush(canvas);
+        });
+        canvas.display();
     }
 }
 
 void Game::processEvents() {
+    frameArena.reset(); // Every frame starts here
+    ScopedPhase phase(profiler, FramePhase::Events);
     while (const std::optional event = window.pollEvent()) {
         if (event->is<sf::Event::Closed>()) window.close();
-        switch (currentState) {
-            case GameState::MENU: handleMenuInput(*event); break;
-            case GameState::PLAYING: handlePlayingInput(*event); break;
-            case GameState::PUZZLE_ACTIVE: handlePuzzleInput(*event); break;
-            case GameState::PAUSED: handlePauseInput(*event); break;
-            default: break;
+        if (playback) continue; // Replays ignore the real keyboard and mouse
+        if (recording) recording->recordEvent(frameNumber, *event);
+        handleEvent(*event);
+    }
+    
+    if (playback) {
+        replayEvents.clear();
+        playback->eventsForFrame(frameNumber, replayEvents);
+        for (const sf::Event& event : replayEvents) handleEvent(event);
+    }
+}
+
+void Game::handleEvent(const sf::Event& event) {
+    if (const auto* keyPressed = event.getIf<sf::Event::KeyPressed>()) {
+        if (keyPressed->code == sf::Keyboard::Key::F3) toggleDebugOverlay();
+        if (keyPressed->code == sf::Keyboard::Key::F4) {
+            overdrawHeatmap = !overdrawHeatmap;
+            RenderStats::heatmapTarget = overdrawHeatmap ? &window : nullptr;
         }
     }
+    switch (currentState) {
+        case GameState::MENU: handleMenuInput(event); break;
+        case GameState::PLAYING: handlePlayingInput(event); break;
+        case GameState::PUZZLE_ACTIVE: handlePuzzleInput(event); break;
+        case GameState::PAUSED: handlePauseInput(event); break;
+        case GameState::GAME_OVER:
+        case GameState::VICTORY: handleGameOverInput(event); break;
+        default: break;
+    }
 }
 
 void Game::handleMenuInput(const sf::Event& event) {
@@ -215,6 +724,9 @@ void Game::handleMenuInput(const sf::Event& event) {
         if (keyPressed->code == sf::Keyboard::Key::Enter) {
             currentState = GameState::PLAYING;
             gameTimer->start();
+            clock.restart(); // Run times count from here
+            roomSplits.clear();
+            roomEnteredAt = GameClock::Duration::zero();
             showStoryText(1);
         }
     }
@@ -226,25 +738,29 @@ void Game::handlePlayingInput(const sf::Event& event) {
         if (keyPressed->code == sf::Keyboard::Key::I) inventory->toggleVisibility();
         if (keyPressed->code == sf::Keyboard::Key::E) { checkDoorInteraction(); checkItemPickup(); }
         if (keyPressed->code == sf::Keyboard::Key::P) checkPuzzleInteraction();
+        if (keyPressed->code == sf::Keyboard::Key::H) showHint();
     }
 }
 
 void Game::handlePuzzleInput(const sf::Event& event) {
+    if (event.is<sf::Event::KeyPressed>() || event.is<sf::Event::TextEntered>() ||
+        event.is<sf::Event::MouseButtonPressed>()) {
+        puzzleCacheDirty = true; // Puzzles only change on input
+    }
     if (activePuzzle) {
-        bool wasSolved = activePuzzle->isSolvedStatus();
-        activePuzzle->handleInput(const_cast<sf::Event&>(event));
+        Puzzle& puzzle = puzzleBase(*activePuzzle);
+        bool wasSolved = puzzle.isSolvedStatus();
+        std::visit([&event](auto& p) { p.handleInput(const_cast<sf::Event&>(event)); }, *activePuzzle);
         
-        if (!wasSolved && activePuzzle->isSolvedStatus()) {
-            gameTimer->addTime(activePuzzle->getTimeBonus());
+        if (!wasSolved && puzzle.isSolvedStatus()) {
+            gameTimer->addTime(puzzle.getTimeBonus());
             showNotification("Puzzle Solved!", sf::Color::Green, 3.0f);
             
             // === REVEAL BACKGROUND (Smooth Fade) ===
-            rooms[currentRoomID]->revealSolvedBackground();
+            currentRoom->revealSolvedBackground();
             
-            if (currentRoomID == 2) rooms[2]->addItem(std::make_shared<Key>("Blue Keycard", "blue_keycard", 650.0f, 500.0f));
-            else if (currentRoomID == 4) rooms[4]->addItem(std::make_shared<Key>("Yellow Keycard", "yellow_keycard", 650.0f, 500.0f));
-            else if (currentRoomID == 5) rooms[5]->addItem(std::make_shared<Key>("Green Keycard", "green_keycard", 650.0f, 500.0f));
-            else if (currentRoomID == 6) rooms[6]->addItem(std::make_shared<Key>("Master Keycard", "master_keycard", 650.0f, 500.0f));
+            // Rewards come from the rule table
+            events.publish(PuzzleSolved{currentRoomID});
         }
     }
     
@@ -263,36 +779,63 @@ void Game::handlePauseInput(const sf::Event& event) {
     }
 }
 
+void Game::handleGameOverInput(const sf::Event& event) {
+    if (const auto* keyPressed = event.getIf<sf::Event::KeyPressed>()) {
+        if (keyPressed->code == sf::Keyboard::Key::Enter) resetGame();
+    }
+}
+
 void Game::update() {
     if (currentState == GameState::PLAYING) updatePlaying();
     if (currentState == GameState::PUZZLE_ACTIVE) updatePuzzle();
+    if (currentState == GameState::PLAYING || currentState == GameState::PUZZLE_ACTIVE) {
+        tweens.update(deltaTime); // Nothing to do unless something animates
+    }
+    
+    // Rules only run for events raised this frame
+    events.dispatch();
 }
 
 void Game::updateMenu() {}
 
 void Game::updatePlaying() {
-    gameTimer->update(deltaTime);
-    if (notificationTimer > 0) notificationTimer -= deltaTime;
-    player->handleInput(deltaTime);
+    timers.advance(clock.getFrameTime()); // Exact, even when deltaTime was clamped
+    movePlayer();
     player->update(deltaTime);
     
-    if (rooms.find(currentRoomID) != rooms.end()) {
-        rooms[currentRoomID]->update(deltaTime); // Update fade transition
-        for (auto& guard : rooms[currentRoomID]->getGuards()) guard->update(deltaTime, *player);
+    {
+        ScopedPhase phase(profiler, FramePhase::GuardUpdate);
+        if (currentRoom) {
+            currentRoom->update(deltaTime); // Update puzzles
+            for (Guard* guard : currentRoom->getGuards()) guard->update(deltaTime);
+        }
+        updateFollowingGuards();
+        updateOffscreenRooms();
+    }
+    {
+        ScopedPhase phase(profiler, FramePhase::GuardDecisions);
+        if (currentRoom) {
+            const std::vector<Guard*>& guards = currentRoom->getGuards();
+            checkGuardDetection(clock.isFixedRate() ? aiScheduler.update(guards, *player, FIXED_AI_TURNS)
+                                                    : aiScheduler.update(guards, *player, AI_BUDGET));
+        }
+    }
+    ScopedPhase phase(profiler, FramePhase::Pathfinding);
+    if (clock.isFixedRate()) {
+        pathScheduler.update(FIXED_PATH_EXPANSIONS);
+    } else {
+        pathScheduler.update(PATH_BUDGET);
     }
-    checkCollisions();
-    checkGuardDetection();
-    checkWinCondition();
-    checkLoseCondition();
 }
 
 void Game::updatePuzzle() {
-    if (activePuzzle) activePuzzle->update(deltaTime);
+    if (activePuzzle) std::visit([this](auto& p) { p.update(deltaTime); }, *activePuzzle);
 }
 
 void Game::updateGameOver() {}
 
 void Game::render() {
+    RenderStats::reset();
     window.clear(sf::Color(20, 20, 30));
     switch (currentState) {
         case GameState::MENU: renderMenu(); break;
@@ -302,148 +845,455 @@ void Game::render() {
         case GameState::VICTORY: renderVictory(); break;
         default: break;
     }
+    if (overdrawHeatmap) {
+        window.clear(sf::Color::Black);
+        RenderStats::drawHeatmap(window);
+    }
+    if (debugOverlayVisible) renderDebugOverlay();
     window.display();
 }
 
-void Game::renderMenu() { window.draw(stateText); }
+void Game::renderMenu() { drawCounted(window, stateText); }
 
+// Everything is submitted to the render queue, then drawn sorted in one go
 void Game::renderPlaying() {
-    if (rooms.find(currentRoomID) != rooms.end()) rooms[currentRoomID]->draw(window);
-    player->draw(window);
-    gameTimer->draw(window);
-    
-    sf::Text roomName(mainFont);
-    roomName.setString("Room: " + rooms[currentRoomID]->getRoomName());
-    roomName.setCharacterSize(18);
-    roomName.setPosition({10.0f, 10.0f});
-    window.draw(roomName);
-    
-    if (inventory->getVisible()) inventory->draw(window);
-    if (notificationTimer > 0) {
-        notificationText.setString(currentNotification);
-        notificationText.setFillColor(notificationColor);
-        window.draw(notificationText);
+    if (currentRoom) {
+        ScopedPhase phase(profiler, FramePhase::RoomDraw);
+        currentRoom->draw(renderQueue);
     }
+    player->draw(renderQueue);
+    {
+        ScopedPhase phase(profiler, FramePhase::Hud);
+        gameTimer->draw(renderQueue);
+        roomNameText.draw(renderQueue);
+        if (inventory->getVisible()) inventory->draw(renderQueue);
+        if (notificationVisible) notificationText.draw(renderQueue);
+    }
+    ScopedPhase phase(profiler, FramePhase::DrawQueue);
+    renderQueue.flush(window);
 }
 
+// The dimming overlay is the cache's clear colour rather than a fullscreen
+// draw of its own - the cached sprite covers the whole screen anyway
 void Game::renderPuzzle() {
     renderPlaying();
-    window.draw(overlay);
-    if (activePuzzle) activePuzzle->display(window);
+    if (!activePuzzle || !puzzleCacheReady) drawCounted(window, overlay);
+    if (!activePuzzle) return;
+    
+    ScopedPhase phase(profiler, FramePhase::PuzzleDraw);
+    if (!puzzleCacheReady) {
+        std::visit([this](auto& p) { p.display(window); }, *activePuzzle);
+        return;
+    }
+    if (puzzleCacheDirty) {
+        puzzleCache.clear(overlay.getFillColor()); // Black, so already premultiplied
+        std::visit([this](auto& p) { p.display(puzzleCache); }, *activePuzzle);
+        puzzleCache.display();
+        puzzleCacheDirty = false;
+    }
+    drawCounted(window, sf::Sprite(puzzleCache.getTexture()), PREMULTIPLIED_ALPHA);
 }
 
 void Game::renderGameOver() {
-    window.draw(overlay);
-    stateText.setString("GAME OVER");
-    window.draw(stateText);
+    drawCounted(window, overlay);
+    drawCounted(window, stateText);
 }
 
 void Game::renderVictory() {
-    window.draw(overlay);
-    stateText.setString("VICTORY!");
-    window.draw(stateText);
+    drawCounted(window, overlay);
+    drawCounted(window, stateText);
 }
 
 void Game::changeRoom(int newRoomID) {
-    if (rooms.find(newRoomID) != rooms.end()) {
+    Room* newRoom = rooms.find(newRoomID);
+    if (newRoom) {
         float spawnX = 100.0f, spawnY = 300.0f;
+        int previousRoomID = currentRoomID;
+        Room* previousRoom = currentRoom;
         
-        // Spawn Logic
-        if (newRoomID == 1) { spawnX = 700.0f; }
-        else if (newRoomID == 7) { spawnX = 100.0f; }
-        else if (newRoomID > currentRoomID) { spawnX = 80.0f; }
-        else { spawnX = 700.0f; }
+        // Spawn Logic - step inside the door that leads back where we came from
+        for (Door* door : newRoom->getDoors()) {
+            if (door->getTargetRoomID() != currentRoomID) continue;
+            sf::FloatRect doorBounds = door->getBounds();
+            float roomCenterX = newRoom->getPosition().x + newRoom->getSize().x / 2.0f;
+            spawnX = doorBounds.position.x < roomCenterX ? doorBounds.position.x + 30.0f : doorBounds.position.x - 50.0f;
+            spawnY = doorBounds.position.y;
+            break;
+        }
 
+        recordSplit();
         currentRoomID = newRoomID;
-        rooms[currentRoomID]->setVisited(true);
+        currentRoom = newRoom;
+        currentRoom->setVisited(true);
+        refreshRoomName();
         player->setPosition(spawnX, spawnY);
+        
+        // Guards chasing the player come after them through the door
+        if (previousRoom) {
+            for (Guard* guard : previousRoom->getGuards()) {
+                if (guard->getState() == GuardState::Chase) followPlayer(guard, previousRoomID, guard->getCenter());
+            }
+        }
         showStoryText(newRoomID);
+        events.publish(RoomEntered{newRoomID, previousRoomID});
         
         // Check if room was already solved previously, keep it open
-        if (rooms[currentRoomID]->allPuzzlesSolved()) {
-            rooms[currentRoomID]->forceSolvedBackground();
+        if (currentRoom->allPuzzlesSolved()) {
+            currentRoom->forceSolvedBackground();
         }
     }
 }
 
+// Route the guard to the player's room; it reappears there after the walk would take.
+// A guard that cannot follow goes back to its patrol - off-screen rooms only
+// advance patrols, so a chase left behind would wait there for the player.
+void Game::followPlayer(Guard* guard, int fromRoomID, const sf::Vector2f& from) {
+    sf::FloatRect bounds = player->getBounds();
+    RoomRoute route;
+    if (!roomRouter.findRoute(fromRoomID, from, currentRoomID, bounds.position + bounds.size / 2.0f, nullptr, route) ||
+        route.steps.empty() || route.steps.size() > MAX_FOLLOW_DOORS) {
+        guard->loseTrail();
+        followingGuards.erase(std::remove_if(followingGuards.begin(), followingGuards.end(),
+                                             [guard](const GuardFollow& follow) { return follow.guard == guard; }),
+                              followingGuards.end());
+        return;
+    }
+    
+    for (GuardFollow& follow : followingGuards) {
+        if (follow.guard == guard) {
+            follow.targetRoomID = currentRoomID;
+            follow.arrivalPoint = route.arrivalPoint;
+            follow.remainingTime = route.length / guard->getChaseSpeed();
+            return;
+        }
+    }
+    followingGuards.push_back({guard, fromRoomID, currentRoomID, route.arrivalPoint, route.length / guard->getChaseSpeed()});
+}
+
+void Game::updateFollowingGuards() {
+    for (std::size_t i = 0; i < followingGuards.size();) {
+        GuardFollow& follow = followingGuards[i];
+        follow.remainingTime -= deltaTime;
+        if (follow.remainingTime > 0.0f) {
+            ++i;
+            continue;
+        }
+        
+        // Move the guard over to the room it was heading for
+        Room* from = rooms.find(follow.roomID);
+        Room* to = rooms.find(follow.targetRoomID);
+        Guard* guard = follow.guard;
+        from->removeGuard(guard);
+        to->addGuard(guard);
+        guard->setCollisionMap(&to->getCollisionMap());
+        sf::FloatRect guardBounds = guard->getBounds();
+        guard->setPosition(follow.arrivalPoint.x - guardBounds.size.x / 2.0f, follow.arrivalPoint.y - guardBounds.size.y / 2.0f);
+        
+        int arrivedIn = follow.targetRoomID;
+        sf::Vector2f arrivalPoint = follow.arrivalPoint;
+        followingGuards[i] = followingGuards.back();
+        followingGuards.pop_back();
+        
+        if (arrivedIn == currentRoomID) {
+            sf::FloatRect bounds = player->getBounds();
+            guard->alert(bounds.position + bounds.size / 2.0f);
+            showNotification("A guard followed you!", sf::Color::Red);
+        } else {
+            followPlayer(guard, arrivedIn, arrivalPoint); // The player moved on meanwhile
+        }
+    }
+}
+
+// Next step towards the exit with the keys in hand, or the key that is missing
+void Game::showHint() {
+    Room* exitRoom = nullptr;
+    for (Room* room : rooms) {
+        if (room->isExit()) { exitRoom = room; break; }
+    }
+    if (!exitRoom) return;
+    if (exitRoom == currentRoom) {
+        showNotification("Hint: what you need is in this room", sf::Color::Cyan);
+        return;
+    }
+    
+    sf::FloatRect bounds = player->getBounds();
+    sf::Vector2f from = bounds.position + bounds.size / 2.0f;
+    sf::Vector2f to = exitRoom->getPosition() + exitRoom->getSize() / 2.0f;
+    RoomRoute route;
+    if (roomRouter.findRoute(currentRoomID, from, exitRoom->getRoomID(), to, inventory.get(), route)) {
+        showNotification(frameArena.concat("Hint: head for the ", rooms.find(route.steps.front().nextRoomID)->getRoomName()),
+                         sf::Color::Cyan);
+        return;
+    }
+    if (roomRouter.findRoute(currentRoomID, from, exitRoom->getRoomID(), to, nullptr, route)) {
+        for (const RouteStep& step : route.steps) {
+            if (RoomRouter::canPass(*step.door, inventory.get())) continue;
+            showNotification(frameArena.format("Hint: find the %s to reach the %s",
+                                               getItemIDName(step.door->getRequiredKeyID()).c_str(),
+                                               rooms.find(step.nextRoomID)->getRoomName().c_str()),
+                             sf::Color::Yellow);
+            return;
+        }
+    }
+    showNotification("Hint: no way forward from here", sf::Color::Red);
+}
+
 void Game::showStoryText(int roomID) {
-    showNotification("Room " + std::to_string(roomID), sf::Color::Cyan);
+    showNotification(frameArena.format("Room %d", roomID), sf::Color::Cyan);
 }
 
-void Game::activatePuzzle(std::shared_ptr<Puzzle> puzzle) {
-    activePuzzle = puzzle;
+void Game::activatePuzzle(PuzzleVariant& puzzle) {
+    std::visit([this](auto& p) { p.onActivate(*inventory); }, puzzle);
+    activePuzzle = &puzzle;
+    puzzleCacheDirty = true;
     currentState = GameState::PUZZLE_ACTIVE;
     gameTimer->pause();
 }
 
-void Game::checkCollisions() {
-    auto bounds = player->getBounds();
-    sf::Vector2f pos = player->getPosition();
-    if (pos.x < 0) player->setPosition(0, pos.y);
-    if (pos.y < 0) player->setPosition(pos.x, 0);
-    if (pos.x > 800 - bounds.size.x) player->setPosition(800 - bounds.size.x, pos.y);
-    if (pos.y > 600 - bounds.size.y) player->setPosition(pos.x, 600 - bounds.size.y);
+// Swept move against the room's collision map - replaces clamping to the screen edges
+void Game::movePlayer() {
+    unsigned held = playback ? playback->getHeld() : Player::readMoveKeys();
+    if (recording) recording->recordHeld(frameNumber, held);
+    sf::Vector2f step = player->handleInput(deltaTime, held);
+    if (step.x == 0.0f && step.y == 0.0f) return;
+    if (currentRoom) step = currentRoom->getCollisionMap().sweep(player->getBounds(), step);
+    player->move(step.x, step.y);
 }
 
-void Game::checkGuardDetection() {
-    for (auto& guard : rooms[currentRoomID]->getGuards()) {
-        if (guard->detectPlayer(*player)) {
-            player->warn();
-            showNotification("CAUGHT!", sf::Color::Red);
+// Patrols in the other rooms keep walking, one job per few rooms. Only plain
+// patrol motion runs here - it touches nothing but the guard itself and its
+// room's (read-only) collision map; everything else waits for the player.
+void Game::updateOffscreenRooms() {
+    jobs.parallelFor(rooms.size(), OFFSCREEN_ROOM_GRAIN, [this](std::size_t begin, std::size_t end) {
+        for (std::size_t slot = begin; slot < end; ++slot) {
+            Room* room = rooms.at(static_cast<int>(slot));
+            if (room == currentRoom) continue;
+            for (Guard* guard : room->getGuards()) {
+                if (guard->getState() == GuardState::Patrol) guard->update(deltaTime);
+            }
         }
+    });
+}
+
+// Every guard that had a turn this frame and can see is tested in one batch
+// against the player's centre
+void Game::checkGuardDetection(const std::vector<Guard*>& guards) {
+    visionCones.clear();
+    visionGuards.clear();
+    for (Guard* guard : guards) {
+        if (!guard->canDetect()) continue;
+        visionCones.push_back(guard->getVisionCone());
+        visionGuards.push_back(guard);
+    }
+    if (visionCones.empty()) return;
+
+    sf::FloatRect bounds = player->getBounds();
+    sf::Vector2f playerCenter = bounds.position + bounds.size / 2.0f;
+    visionHits.resize(visionCones.size());
+    detectInBatch(currentRoom->getCollisionMap(), visionCones.data(), visionCones.size(), playerCenter, visionHits.data(), &jobs);
+
+    for (std::size_t i = 0; i < visionGuards.size(); ++i) {
+        if (!visionHits[i]) continue;
+        visionGuards[i]->onPlayerSpotted(playerCenter);
+        events.publish(PlayerDetected{currentRoomID, visionGuards[i]});
     }
 }
 
 void Game::checkDoorInteraction() {
-    auto& doors = rooms[currentRoomID]->getDoors();
+    auto& doors = currentRoom->getDoors();
     auto bounds = player->getBounds();
     for (auto& door : doors) {
         if (door->checkCollision(bounds)) {
             if (door->getLockedStatus()) {
-                // Key Logic (Simplified for brevity)
-                // You can add your specific key checks back here
-                showNotification("Locked!", sf::Color::Red);
-            } else {
-                changeRoom(door->getTargetRoomID());
+                ItemID keyID = door->getRequiredKeyID();
+                bool holdingKey = keyID == INVALID_ITEM_ID || inventory->hasKey(keyID);
+                if (!holdingKey || !door->canOpen(keyID)) {
+                    showNotification("Locked!", sf::Color::Red);
+                    return;
+                }
             }
+            changeRoom(door->getTargetRoomID());
+            return; // Player now stands in another room - stop checking this one's doors
         }
     }
 }
 
 void Game::checkItemPickup() {
-    auto& items = rooms[currentRoomID]->getItems();
+    ScopedPhase phase(profiler, FramePhase::ItemPickup);
+    auto& items = currentRoom->getItems();
     auto bounds = player->getBounds();
     for (auto& item : items) {
         if (!item->isItemCollected() && item->checkCollision(bounds)) {
+            // A full bag leaves the item where it is - no pickup, no ItemCollected rules
+            if (!inventory->addItem(item)) {
+                if (!notificationVisible) showNotification("Inventory full!", sf::Color::Red);
+                continue;
+            }
             item->collect();
-            player->addItem(item.get());
-            inventory->addItem(item);
-            showNotification("Picked up " + item->getName(), sf::Color::Cyan);
+            player->addItem(item);
+            showNotification(frameArena.concat("Picked up ", item->getName()), sf::Color::Cyan);
+            events.publish(ItemCollected{item->getID(), currentRoomID});
         }
     }
 }
 
 void Game::checkPuzzleInteraction() {
-    auto& puzzles = rooms[currentRoomID]->getPuzzles();
-    for (auto& puzzle : puzzles) {
-        if (!puzzle->isSolvedStatus()) {
-            activatePuzzle(puzzle);
+    for (PuzzleVariant* puzzle : currentRoom->getPuzzles()) {
+        if (!puzzleBase(*puzzle).isSolvedStatus()) {
+            activatePuzzle(*puzzle);
             return;
         }
     }
 }
 
-void Game::checkWinCondition() { if (inventory->hasItem("Evidence File")) setGameOver(true); }
-void Game::checkLoseCondition() { if (gameTimer->isExpired()) setGameOver(false); }
+void Game::applyRule(const GameRule& rule, int roomID) {
+    switch (rule.action) {
+        case RuleAction::SpawnKey:
+            if (Room* room = rooms.find(roomID)) room->addItem(levelArena.create<Key>(rule.text, rule.keyID, rule.x, rule.y));
+            break;
+        case RuleAction::Victory:
+        case RuleAction::Defeat:
+            // A run ends once - a later end rule in the same frame must not stop and print it again
+            if (currentState == GameState::VICTORY || currentState == GameState::GAME_OVER) break;
+            setGameOver(rule.action == RuleAction::Victory);
+            break;
+        case RuleAction::WarnPlayer:
+            player->warn();
+            showNotification(rule.text, sf::Color::Red);
+            break;
+        case RuleAction::Notify: showNotification(rule.text, sf::Color::Cyan); break;
+    }
+}
+
 void Game::setGameOver(bool victory) {
     currentState = victory ? GameState::VICTORY : GameState::GAME_OVER;
+    stateText.setString(victory ? "VICTORY!" : "GAME OVER");
     gameTimer->stop();
+    recordSplit();
+    printRunTimes(victory);
+}
+void Game::pauseGame() { currentState = GameState::PAUSED; gameTimer->pause(); clock.pause(); }
+void Game::resumeGame() { currentState = GameState::PLAYING; gameTimer->resume(); clock.resume(); }
+void Game::resetGame() {
+    currentState = GameState::MENU;
+    gameTimer->reset();
+    currentRoomID = level.getView().startRoomID;
+    loadLevel();
+    player->setPosition(level.getView().startX, level.getView().startY);
+    player->resetWarning();
+}
+void Game::recordSplit() {
+    GameClock::Duration now = clock.getGameTime();
+    roomSplits.push_back({currentRoomID, now - roomEnteredAt});
+    roomEnteredAt = now;
+}
+
+// Speedrun summary on the console: total, pause and timer accounting, then per-room splits
+void Game::printRunTimes(bool victory) {
+    std::cout << (victory ? "Escaped" : "Caught") << " in " << formatRunTime(clock.getGameTime())
+              << " (real " << formatRunTime(clock.getRealTime()) << ", paused " << formatRunTime(clock.getPausedTime())
+              << ", bonus +" << formatRunTime(gameTimer->getBonusTime())
+              << ", penalty -" << formatRunTime(gameTimer->getPenaltyTime()) << ")" << std::endl;
+    for (const RoomSplit& split : roomSplits) {
+        Room* room = rooms.find(split.roomID);
+        std::cout << "  " << std::left << std::setw(28) << (room ? room->getRoomName() : std::to_string(split.roomID))
+                  << std::right << formatRunTime(split.time) << std::endl;
+    }
+}
+
+void Game::showNotification(std::string_view message, const sf::Color& color, float duration) {
+    notificationText.set(message); // Re-laid out on the next draw, and only if it differs
+    notificationText.getText().setFillColor(color);
+    timers.cancel(notificationExpiry);
+    if (!notificationVisible) {
+        tweens.tweenPosition(notificationText.getText(), NOTIFICATION_POSITION - sf::Vector2f(NOTIFICATION_SLIDE, 0.0f),
+                             NOTIFICATION_POSITION, NOTIFICATION_SLIDE_SECONDS);
+    }
+    notificationVisible = true;
+    notificationExpiry = timers.schedule(std::chrono::duration_cast<TimerWheel::Duration>(std::chrono::duration<float>(duration)),
+                                         [this]() { notificationVisible = false; });
+}
+
+void Game::refreshRoomName() {
+    if (!currentRoom) return;
+    FixedText<HudText::CAPACITY> label;
+    roomNameText.set(label.append("Room: ").append(currentRoom->getRoomName()).view());
+}
+
+// ============================================================================
+// DEBUG OVERLAY (F3)
+// ============================================================================
+
+void Game::toggleDebugOverlay() {
+    if (profiler && profiler != &overlayStats) return; // --stress or similar is measuring
+    debugOverlayVisible = !debugOverlayVisible;
+    profiler = debugOverlayVisible ? &overlayStats : nullptr;
+    overlayStats.reset();
+    overlayFrames = 0;
+    overlayAllocations.fill(0.0f);
+    debugText.setString("");
+}
+
+// Runs between frames, so the overlay's own text layout is not in the numbers
+void Game::refreshDebugOverlay() {
+    if (++overlayFrames < OVERLAY_REFRESH_FRAMES) return;
+    
+    char text[1024];
+    int length = std::snprintf(text, sizeof(text), "allocs/frame    us/phase\n");
+    for (std::size_t i = 0; i < overlayAllocations.size(); ++i) {
+        FramePhase phase = static_cast<FramePhase>(i);
+        overlayAllocations[i] = static_cast<float>(overlayStats.getAllocations(phase)) / overlayFrames;
+        if (length < 0 || static_cast<std::size_t>(length) >= sizeof(text)) continue;
+        // The frame row's time includes the frame cap, so only its allocations are shown
+        if (phase == FramePhase::Frame) {
+            length += std::snprintf(text + length, sizeof(text) - length, "%-16s %6.2f\n",
+                                    FrameProfiler::phaseName(phase), overlayAllocations[i]);
+        } else {
+            length += std::snprintf(text + length, sizeof(text) - length, "%-16s %6.2f %8.1f\n",
+                                    FrameProfiler::phaseName(phase), overlayAllocations[i],
+                                    overlayStats.getAverageMicroseconds(phase));
+        }
+    }
+    if (length >= 0 && static_cast<std::size_t>(length) < sizeof(text)) {
+        length += std::snprintf(text + length, sizeof(text) - length, "arena %.1f/%.0f KB peak, %llu overflows\n",
+                                frameArena.getPeak() / 1024.0, frameArena.getCapacity() / 1024.0,
+                                static_cast<unsigned long long>(frameArena.getFailedCount()));
+    }
+    // Last frame's draws (F4 shows where the overdraw is)
+    const RenderStats::Counters& draws = RenderStats::frame;
+    if (length >= 0 && static_cast<std::size_t>(length) < sizeof(text)) {
+        std::snprintf(text + length, sizeof(text) - length,
+                      "draws %llu  verts %llu  binds %llu  culled %llu  overdraw %.2fx\nstate changes saved by sorting %llu",
+                      static_cast<unsigned long long>(draws.drawCalls), static_cast<unsigned long long>(draws.vertices),
+                      static_cast<unsigned long long>(draws.textureBinds), static_cast<unsigned long long>(draws.culled),
+                      RenderStats::overdraw(window), static_cast<unsigned long long>(draws.stateChangesSaved));
+    }
+    debugText.setString(text);
+    overlayStats.reset();
+    overlayFrames = 0;
+}
+
+// Text plus one allocation bar per phase; the bars are rebuilt every frame in
+// the frame arena and drawn in a single call
+void Game::renderDebugOverlay() {
+    drawCounted(window, debugText);
+    
+    const std::size_t phaseCount = overlayAllocations.size();
+    sf::Vertex* bars = frameArena.allocateArray<sf::Vertex>(phaseCount * 6);
+    if (!bars) return;
+    float left = debugText.getPosition().x + 230.0f;
+    float top = debugText.getPosition().y + OVERLAY_LINE_HEIGHT + 3.0f;
+    for (std::size_t i = 0; i < phaseCount; ++i) {
+        float allocations = overlayAllocations[i];
+        float width = allocations > 0.0f ? std::min(OVERLAY_BAR_MAX, 2.0f + allocations * OVERLAY_BAR_PER_ALLOCATION) : 2.0f;
+        sf::Color color = allocations > 0.0f ? sf::Color(220, 60, 60) : sf::Color(60, 200, 90);
+        float y = top + i * OVERLAY_LINE_HEIGHT;
+        sf::Vector2f corners[4] = {{left, y}, {left + width, y}, {left + width, y + 10.0f}, {left, y + 10.0f}};
+        const int order[6] = {0, 1, 2, 0, 2, 3};
+        for (int v = 0; v < 6; ++v) {
+            bars[i * 6 + v].position = corners[order[v]];
+            bars[i * 6 + v].color = color;
+        }
+    }
+    drawCounted(window, bars, phaseCount * 6, sf::PrimitiveType::Triangles);
 }
-void Game::pauseGame() { currentState = GameState::PAUSED; gameTimer->pause(); }
-void Game::resumeGame() { currentState = GameState::PLAYING; gameTimer->resume(); }
-void Game::resetGame() { currentState = GameState::MENU; gameTimer->reset(); }
-void Game::showNotification(const std::string& message, const sf::Color& color, float duration) {
-    currentNotification = message;
-    notificationColor = color;
-    notificationTimer = duration;
-}
\ No newline at end of file
@@ -5,18 +5,43 @@
 #include <SFML/Audio.hpp>
 #include <memory>
 #include <vector>
-#include <map>
+#include <optional>
+#include <cstdint>
+#include <array>
+#include <string_view>
 #include "Player.h"
 #include "Room.h"
+#include "Puzzle.h"
 #include "Timer.h"
 #include "Item.h"
+#include "LevelArena.h"
+#include "RoomTable.h"
+#include "GameEvents.h"
+#include "GameRules.h"
+#include "Level.h"
+#include "Pathfinding.h"
+#include "RoomRouter.h"
+#include "Vision.h"
+#include "AIScheduler.h"
+#include "JobSystem.h"
+#include "FrameProfiler.h"
+#include "MicroBench.h"
+#include "Replay.h"
+#include "FrameArena.h"
+#include "GameClock.h"
+#include "TimerWheel.h"
+#include "Tween.h"
+#include "RenderQueue.h"
 
 enum class GameState { MENU, PLAYING, PAUSED, PUZZLE_ACTIVE, GAME_OVER, VICTORY };
 
 class Game {
 private:
     sf::RenderWindow window;
-    sf::Clock clock;
+    GameClock clock; // Exact real/game/paused time; deltaTime is its clamped step
+    TimerWheel timers; // Every countdown of the level, advanced in game time while playing
+    TweenSystem tweens; // Every running animation, advanced while playing or in a puzzle
+    JobSystem jobs; // Worker per spare core: asset decoding, off-screen rooms, big detection batches
     float deltaTime;
     GameState currentState;
     
@@ -24,12 +49,47 @@ private:
     std::unique_ptr<Timer> gameTimer;
     std::unique_ptr<Inventory> inventory;
     
-    std::map<int, std::shared_ptr<Room>> rooms;
-    std::map<int, sf::Texture> roomTextures;
-    std::map<int, sf::Texture> solvedRoomTextures; // <--- NEW MAP
+    std::string levelPath; // Level file given on the command line ("" = default search)
+    Level level;           // Level records the rooms are built from
+    LevelArena levelArena; // Owns every room/item/guard/door of the level
+    std::vector<PuzzleVariant> puzzles; // The level's puzzles by value, reserved up front so they never move
+    RoomTable rooms;
+    std::vector<std::optional<sf::Texture>> roomTextures;       // Indexed by room ID
+    std::vector<std::optional<sf::Texture>> solvedRoomTextures; // Indexed by room ID
+    std::vector<std::uint8_t> solvedRoomOpaque; // Indexed by room ID - the open image has no transparent pixels
 
     int currentRoomID;
-    std::shared_ptr<Puzzle> activePuzzle;
+    Room* currentRoom; // Cached rooms.find(currentRoomID)
+    
+    GameEventBus events;
+    RuleEngine ruleEngine;
+    PathScheduler pathScheduler; // Guard pathfinding, time-sliced each frame
+    AIScheduler aiScheduler;     // Guard decisions, time-sliced each frame
+    RoomRouter roomRouter;       // Cross-room routes for hints and guards following through doors
+    
+    // A chasing guard on its way through the doors after the player (off-screen)
+    struct GuardFollow {
+        Guard* guard;
+        int roomID;             // Room the guard is still listed in
+        int targetRoomID;
+        sf::Vector2f arrivalPoint;
+        float remainingTime;    // Walking time left, from the route length
+    };
+    std::vector<GuardFollow> followingGuards;
+    
+    // Per-frame detection batch, reused so the pass never allocates
+    std::vector<VisionCone> visionCones;
+    std::vector<Guard*> visionGuards;
+    std::vector<std::uint8_t> visionHits;
+    PuzzleVariant* activePuzzle;
+    
+    // Speedrun splits: game time spent in each room this run, in visiting order
+    struct RoomSplit {
+        int roomID;
+        GameClock::Duration time;
+    };
+    std::vector<RoomSplit> roomSplits;
+    GameClock::Duration roomEnteredAt;
     
     sf::Texture playerTexture;
     sf::Texture guardTexture;
@@ -38,25 +98,71 @@ private:
     sf::Font notificationFont;
     sf::Music backgroundMusic;
     
+    RenderQueue renderQueue; // The playing scene, sorted before it is drawn
+    
     sf::Text stateText;
     sf::RectangleShape overlay;
     
-    sf::Text notificationText;
-    std::string currentNotification;
-    float notificationTimer;
-    sf::Color notificationColor;
+    HudText roomNameText;
+    HudText notificationText;
+    bool notificationVisible; // Cleared by notificationExpiry
+    TimerId notificationExpiry;
+    
+    // The open puzzle is drawn into this once per change and shown as one sprite
+    sf::RenderTexture puzzleCache;
+    bool puzzleCacheReady;
+    bool puzzleCacheDirty;
+    
+    FrameProfiler* profiler; // Set while something measures frames (nullptr = off)
+    FrameArena frameArena;   // Scratch strings/vertices, freed at the start of every frame
+    
+    // F3 debug overlay: per-phase allocations and times, averaged over a few frames
+    FrameProfiler overlayStats;
+    bool debugOverlayVisible;
+    int overlayFrames; // Frames in overlayStats since the text was refreshed
+    std::array<float, static_cast<std::size_t>(FramePhase::Count)> overlayAllocations; // Per frame
+    sf::Text debugText;
+    bool overdrawHeatmap; // F4: draw coverage instead of the scene
+    
+    // Input replays (--record / --bench): frames count from the start of the run
+    Replay* playback;  // Input comes from here instead of the window (nullptr = live)
+    Replay* recording; // Live input is also written here (nullptr = off)
+    std::uint32_t frameNumber;
+    std::vector<sf::Event> replayEvents; // This frame's played-back events, reused
     
 public:
-    Game();
+    explicit Game(const std::string& levelFile = "");
     ~Game();
     void run();
     
+    // Scaling run (game.exe --stress): visit every room for framesPerRoom fixed
+    // 60 Hz steps, trying item pickups each frame, then print per-phase timings
+    void runStress(int framesPerRoom);
+    
+    // Microbenchmarks of the per-frame hot paths (game.exe --microbench), on the
+    // loaded level; drawing goes to an offscreen texture
+    void runMicroBenchmarks(MicroBench& bench);
+    
+    // Play normally at a fixed 60 Hz step, writing the input into replay
+    // (game.exe --record)
+    void record(Replay& replay);
+    
+    // Whole-game benchmark (game.exe --bench): play a recorded session as fast
+    // as possible and write frame-time percentiles, hitches, draw calls,
+    // allocations and peak RSS to reportPath as JSON. False if the report
+    // could not be written or the session never reached victory (the replay
+    // no longer matches the game).
+    bool runBench(Replay& session, const std::string& reportPath);
+    
 private:
     void initialize();
     void loadAssets();
+    void loadLevelData();
+    void loadLevel();
     void createRooms();
     void setupPuzzles();
     void processEvents();
+    void handleEvent(const sf::Event& event);
     void update();
     void render();
     
@@ -64,6 +170,7 @@ private:
     void handlePlayingInput(const sf::Event& event);
     void handlePuzzleInput(const sf::Event& event);
     void handlePauseInput(const sf::Event& event);
+    void handleGameOverInput(const sf::Event& event);
     
     void updateMenu();
     void updatePlaying();
@@ -76,20 +183,29 @@ private:
     void renderVictory();
     
     void changeRoom(int newRoomID);
-    void activatePuzzle(std::shared_ptr<Puzzle> puzzle);
-    void checkCollisions();
-    void checkGuardDetection();
+    void activatePuzzle(PuzzleVariant& puzzle);
+    void movePlayer();
+    void checkGuardDetection(const std::vector<Guard*>& guards);
+    void updateOffscreenRooms();
     void checkDoorInteraction();
     void checkItemPickup();
     void checkPuzzleInteraction();
+    void followPlayer(Guard* guard, int fromRoomID, const sf::Vector2f& from);
+    void updateFollowingGuards();
+    void showHint();
     
-    void checkWinCondition();
-    void checkLoseCondition();
+    void applyRule(const GameRule& rule, int roomID);
     void setGameOver(bool victory);
     void resetGame();
     void pauseGame();
     void resumeGame();
-    void showNotification(const std::string& message, const sf::Color& color, float duration = 3.0f);
+    void recordSplit();
+    void printRunTimes(bool victory);
+    void showNotification(std::string_view message, const sf::Color& color, float duration = 3.0f);
+    void refreshRoomName();
+    void toggleDebugOverlay();
+    void refreshDebugOverlay();
+    void renderDebugOverlay();
     void showStoryText(int roomID);
 };
 #endif
\ No newline at end of file
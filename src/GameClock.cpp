@@ -0,0 +1,65 @@
+/*
+ * Museum Escape - Game Clock Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "GameClock.h"
+#include <algorithm>
+
+namespace {
+    const std::int64_t NANOSECONDS_PER_SECOND = 1000000000;
+}
+
+GameClock::GameClock()
+    : lastTick(std::chrono::steady_clock::now()),
+      realTime(Duration::zero()),
+      gameTime(Duration::zero()),
+      frameTime(Duration::zero()),
+      fixedRate(0),
+      fixedFrames(0),
+      paused(false) {}
+
+void GameClock::restart() {
+    lastTick = std::chrono::steady_clock::now();
+    realTime = gameTime = frameTime = Duration::zero();
+    fixedFrames = 0;
+}
+
+void GameClock::setFixedRate(std::uint32_t framesPerSecond) {
+    fixedRate = framesPerSecond;
+    fixedFrames = 0;
+    lastTick = std::chrono::steady_clock::now();
+}
+
+void GameClock::tick() {
+    Duration elapsed;
+    if (fixedRate > 0) {
+        // Frame boundaries at n * 1e9 / rate - rounded once each, never accumulated
+        std::int64_t before = static_cast<std::int64_t>(fixedFrames) * NANOSECONDS_PER_SECOND / fixedRate;
+        ++fixedFrames;
+        std::int64_t after = static_cast<std::int64_t>(fixedFrames) * NANOSECONDS_PER_SECOND / fixedRate;
+        elapsed = Duration(after - before);
+    } else {
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        elapsed = std::chrono::duration_cast<Duration>(now - lastTick);
+        lastTick = now;
+    }
+    
+    realTime += elapsed;
+    frameTime = paused ? Duration::zero() : elapsed;
+    gameTime += frameTime;
+}
+
+void GameClock::pause() { paused = true; }
+void GameClock::resume() { paused = false; }
+bool GameClock::isPaused() const { return paused; }
+bool GameClock::isFixedRate() const { return fixedRate > 0; }
+
+GameClock::Duration GameClock::getRealTime() const { return realTime; }
+GameClock::Duration GameClock::getGameTime() const { return gameTime; }
+GameClock::Duration GameClock::getPausedTime() const { return realTime - gameTime; }
+GameClock::Duration GameClock::getFrameTime() const { return frameTime; }
+
+float GameClock::getStepSeconds() const {
+    return std::chrono::duration<float>(std::min(frameTime, MAX_STEP)).count();
+}
@@ -0,0 +1,50 @@
+#ifndef GAMECLOCK_H
+#define GAMECLOCK_H
+
+#include <chrono>
+#include <cstdint>
+
+// GameClock - the game's time in integer nanoseconds from std::chrono::steady_clock.
+// Tracks three totals that never drift apart through float rounding:
+//   real   - everything since restart()
+//   game   - real minus the time spent paused
+//   paused - real minus game
+// tick() once per frame. The frame's exact game time feeds the countdown and
+// the room splits; the simulation gets a float step clamped to MAX_STEP so a
+// hitch cannot throw the player through a wall, without the countdown losing
+// the time. With a fixed rate (replays, --stress) frame n ends at exactly
+// n / rate seconds, so recorded runs time identically.
+class GameClock {
+public:
+    using Duration = std::chrono::nanoseconds;
+    static constexpr Duration MAX_STEP = std::chrono::milliseconds(100);
+
+private:
+    std::chrono::steady_clock::time_point lastTick;
+    Duration realTime;
+    Duration gameTime;
+    Duration frameTime;          // Game time the last tick added
+    std::uint32_t fixedRate;     // Frames per second; 0 = follow steady_clock
+    std::uint64_t fixedFrames;   // Ticks since restart() in fixed-rate mode
+    bool paused;
+
+public:
+    GameClock();
+
+    void restart();                                 // Zero all totals; keeps the rate
+    void setFixedRate(std::uint32_t framesPerSecond); // 0 = real time
+    bool isFixedRate() const;
+    void tick();
+
+    void pause();
+    void resume();
+    bool isPaused() const;
+
+    Duration getRealTime() const;
+    Duration getGameTime() const;
+    Duration getPausedTime() const;
+    Duration getFrameTime() const;  // Exact game time of the last frame (0 while paused)
+    float getStepSeconds() const;   // The same, clamped to MAX_STEP, for the simulation
+};
+
+#endif // GAMECLOCK_H
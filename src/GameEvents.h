@@ -0,0 +1,33 @@
+#ifndef GAMEEVENTS_H
+#define GAMEEVENTS_H
+
+#include "EventBus.h"
+#include "ItemID.h"
+
+class Guard;
+
+// Gameplay events - raised where things happen, consumed by the rule engine
+struct ItemCollected {
+    ItemID itemID;
+    int roomID;
+};
+
+struct PuzzleSolved {
+    int roomID;
+};
+
+struct TimerExpired {};
+
+struct RoomEntered {
+    int roomID;
+    int fromRoomID;
+};
+
+struct PlayerDetected {
+    int roomID;
+    const Guard* guard;
+};
+
+using GameEventBus = EventBus<ItemCollected, PuzzleSolved, TimerExpired, RoomEntered, PlayerDetected>;
+
+#endif // GAMEEVENTS_H
@@ -0,0 +1,49 @@
+/*
+ * Museum Escape - Rule Engine Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "GameRules.h"
+
+RuleEngine::RuleEngine() {}
+
+void RuleEngine::connect(GameEventBus& bus, ActionHandler actionHandler) {
+    handler = std::move(actionHandler);
+
+    bus.subscribe<ItemCollected>([this](const ItemCollected& e) {
+        fire(RuleTrigger::ItemCollected, e.roomID, e.itemID);
+    });
+    bus.subscribe<PuzzleSolved>([this](const PuzzleSolved& e) {
+        fire(RuleTrigger::PuzzleSolved, e.roomID, INVALID_ITEM_ID);
+    });
+    bus.subscribe<TimerExpired>([this](const TimerExpired&) {
+        fire(RuleTrigger::TimerExpired, -1, INVALID_ITEM_ID);
+    });
+    bus.subscribe<RoomEntered>([this](const RoomEntered& e) {
+        fire(RuleTrigger::RoomEntered, e.roomID, INVALID_ITEM_ID);
+    });
+    bus.subscribe<PlayerDetected>([this](const PlayerDetected& e) {
+        fire(RuleTrigger::PlayerDetected, e.roomID, INVALID_ITEM_ID);
+    });
+}
+
+void RuleEngine::setRules(const GameRule* first, std::size_t count) {
+    rules.assign(first, first + count);
+    for (auto& bucket : rulesByTrigger) bucket.clear();
+    for (std::size_t i = 0; i < rules.size(); ++i) {
+        rulesByTrigger[static_cast<std::size_t>(rules[i].trigger)].push_back(i);
+    }
+}
+
+const std::vector<GameRule>& RuleEngine::getRules() const { return rules; }
+
+void RuleEngine::fire(RuleTrigger trigger, int roomID, ItemID itemID) {
+    if (!handler) return;
+
+    for (std::size_t index : rulesByTrigger[static_cast<std::size_t>(trigger)]) {
+        const GameRule& rule = rules[index];
+        if (rule.roomID != -1 && rule.roomID != roomID) continue;
+        if (rule.itemID != INVALID_ITEM_ID && rule.itemID != itemID) continue;
+        handler(rule, roomID);
+    }
+}
@@ -0,0 +1,66 @@
+#ifndef GAMERULES_H
+#define GAMERULES_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+#include "GameEvents.h"
+
+// Which event a rule listens to
+enum class RuleTrigger : std::uint8_t {
+    ItemCollected,
+    PuzzleSolved,
+    TimerExpired,
+    RoomEntered,
+    PlayerDetected,
+    Count
+};
+
+// What a rule does when it matches
+enum class RuleAction : std::uint8_t {
+    SpawnKey,   // Drop a Key(text, keyID) at (x, y) in the event's room
+    Victory,
+    Defeat,
+    WarnPlayer, // Warn the player and show text
+    Notify      // Show text
+};
+
+// One row of the rule table. roomID -1 / itemID INVALID_ITEM_ID match anything.
+struct GameRule {
+    RuleTrigger trigger;
+    int roomID;
+    ItemID itemID;
+    RuleAction action;
+    const char* text;
+    const char* keyID;
+    float x;
+    float y;
+};
+
+// RuleEngine - reacts to bus events by running the matching rows of a rule table.
+// Rules are bucketed by trigger, so an event only looks at rules that can match it
+// and nothing is evaluated on frames where nothing happens.
+class RuleEngine {
+public:
+    using ActionHandler = std::function<void(const GameRule& rule, int roomID)>;
+
+private:
+    std::vector<GameRule> rules;
+    std::array<std::vector<std::size_t>, static_cast<std::size_t>(RuleTrigger::Count)> rulesByTrigger;
+    ActionHandler handler;
+
+public:
+    RuleEngine();
+
+    // Subscribe to the bus; handler runs the action of every matching rule
+    void connect(GameEventBus& bus, ActionHandler actionHandler);
+
+    void setRules(const GameRule* first, std::size_t count);
+    const std::vector<GameRule>& getRules() const;
+
+private:
+    void fire(RuleTrigger trigger, int roomID, ItemID itemID);
+};
+
+#endif // GAMERULES_H
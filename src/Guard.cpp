@@ -6,8 +6,17 @@
 
 #include "Guard.h"
 #include "Player.h"
+#include "CollisionMap.h"
+#include <algorithm>
 #include <cmath>
 
+namespace {
+    const float CHASE_TIME = 3.0f;        // Seconds a guard keeps chasing after a detection
+    const float CHASE_SPEED_SCALE = 1.25f;
+    const float WAYPOINT_RADIUS = 4.0f;
+    const float VISION_HALF_ANGLE = 0.785398f; // 45 degrees either side = 90 degree cone
+}
+
 // Constructor - CHANGED to use Texture
 Guard::Guard(float x, float y, float detectionRange, const sf::Texture& texture)
     : position(x, y),
@@ -16,33 +25,43 @@ Guard::Guard(float x, float y, float detectionRange, const sf::Texture& texture)
       currentPatrolIndex(0),
       movingForward(true),
       detectionRadius(detectionRange),
-      hasDetectedPlayer(false),
-      detectionCooldown(0.0f),
+      facing(1.0f, 0.0f),
+      coolingDown(false),
       cooldownTime(2.0f),
-      detectionCircle(detectionRange) 
+      timerWheel(nullptr),
+      state(GuardState::Patrol),
+      chaseTimer(0.0f),
+      lastKnownPlayerPosition(x, y),
+      pathIndex(0),
+      stalled(false),
+      pathScheduler(nullptr),
+      collisionMap(nullptr)
 {
     sprite.setPosition(position);
     sprite.setColor(sf::Color(255, 200, 200)); 
     
-    detectionCircle.setFillColor(sf::Color(255, 0, 0, 30));
-    detectionCircle.setOutlineThickness(1.0f);
-    detectionCircle.setOutlineColor(sf::Color(255, 0, 0, 100));
-    
-    sf::FloatRect bounds = sprite.getLocalBounds();
-    detectionCircle.setOrigin({detectionRange - bounds.size.x/2.0f, detectionRange - bounds.size.y/2.0f});
-    detectionCircle.setPosition(position);
     sprite.setScale({0.05f, 0.05f});
 }
 
 // Add patrol point
 void Guard::addPatrolPoint(float x, float y) {
     patrolPoints.push_back({x, y});
+    if (patrolPoints.size() == 2) faceFirstLeg();
 }
 
 // Set all patrol points at once
 void Guard::setPatrolPoints(const std::vector<sf::Vector2f>& points) {
     patrolPoints = points;
     currentPatrolIndex = 0;
+    faceFirstLeg();
+}
+
+// Start out looking along the first leg of the route
+void Guard::faceFirstLeg() {
+    if (patrolPoints.size() < 2) return;
+    sf::Vector2f leg = patrolPoints[1] - patrolPoints[0];
+    float length = std::sqrt(leg.x * leg.x + leg.y * leg.y);
+    if (length > 0.001f) facing = leg / length;
 }
 
 // Patrol between waypoints
@@ -52,7 +71,6 @@ void Guard::patrol(float deltaTime) {
     if (patrolPoints.size() == 1) {
         position = patrolPoints[0];
         sprite.setPosition(position);
-        detectionCircle.setPosition(position);
         return;
     }
     
@@ -80,31 +98,138 @@ void Guard::patrol(float deltaTime) {
         float normalizedX = dx / distance;
         float normalizedY = dy / distance;
         
-        position.x += normalizedX * speed * deltaTime;
-        position.y += normalizedY * speed * deltaTime;
-        
-        sprite.setPosition(position);
-        detectionCircle.setPosition(position);
+        moveBy({normalizedX * speed * deltaTime, normalizedY * speed * deltaTime});
     }
 }
 
-void Guard::setRoomBounds(const sf::FloatRect& bounds) {
-    roomBounds = bounds;
+// Slide along the room geometry (swept against the collision map)
+void Guard::moveBy(const sf::Vector2f& step) {
+    sf::Vector2f resolved = collisionMap ? collisionMap->sweep(getBounds(), step) : step;
+    position += resolved;
+    sprite.setPosition(position);
+    
+    // Face where we are trying to go, even when a wall holds us back
+    float length = std::sqrt(step.x * step.x + step.y * step.y);
+    if (length > 0.001f) facing = step / length;
 }
 
-bool Guard::detectPlayer(const Player& player) {
-    if (detectionCooldown > 0) return false;
+// Straight-line steering, used when there is no path (yet)
+void Guard::moveTowards(const sf::Vector2f& target, float deltaTime) {
+    sf::Vector2f offset = target - getCenter();
+    float distance = std::sqrt(offset.x * offset.x + offset.y * offset.y);
+    if (distance < WAYPOINT_RADIUS) return;
+    float stepLength = std::min(distance, speed * deltaTime);
+    moveBy(offset / distance * stepLength);
+}
+
+void Guard::alert(const sf::Vector2f& playerPosition) {
+    if (pathScheduler) pathScheduler->cancelPath(search);
+    state = GuardState::Chase;
+    chaseTimer = CHASE_TIME;
+    lastKnownPlayerPosition = playerPosition;
+}
+
+void Guard::loseTrail() {
+    if (pathScheduler) pathScheduler->cancelPath(search);
+    state = GuardState::Patrol;
+    chaseTimer = 0.0f;
+    stalled = false;
+}
+
+// All chasing guards in a room request the flow field for the player's tile,
+// so however many give chase it is computed once
+void Guard::chase(float deltaTime) {
+    sf::Vector2f direction;
+    if (pathScheduler && collisionMap) {
+        direction = pathScheduler->requestFlowField(*collisionMap, lastKnownPlayerPosition)->directionFrom(getCenter());
+    }
+    if (direction.x == 0.0f && direction.y == 0.0f) {
+        // Field still being built (or no pathfinding) - head straight for the player
+        moveTowards(lastKnownPlayerPosition, deltaTime * CHASE_SPEED_SCALE);
+        return;
+    }
+    moveBy(direction * speed * CHASE_SPEED_SCALE * deltaTime);
+}
+
+void Guard::startPath(const sf::Vector2f& target, GuardState nextState) {
+    state = nextState;
+    pathIndex = 0;
+    stalled = false;
+    if (pathScheduler && collisionMap) pathScheduler->requestPath(search, *collisionMap, getCenter(), target);
+}
+
+// Where a returning guard is headed: its patrol point, as a centre position
+sf::Vector2f Guard::homePoint() const {
+    sf::Vector2f homeOffset = getCenter() - position; // Patrol points are sprite positions
+    sf::Vector2f home = patrolPoints.empty() ? position : patrolPoints[currentPatrolIndex];
+    return home + homeOffset;
+}
+
+// Walk the A* result
+void Guard::followPath(float deltaTime) {
+    bool usePath = pathScheduler && collisionMap;
+    if (stalled || (usePath && !search.isFinished())) return; // Waiting for think() or the scheduler
     
-    float distance = distanceTo(player.getPosition());
+    sf::Vector2f goal = state == GuardState::Investigate ? lastKnownPlayerPosition : homePoint();
     
-    if (distance < detectionRadius) {
-        hasDetectedPlayer = true;
-        detectionCooldown = cooldownTime;
-        return true;
+    sf::Vector2f waypoint = goal;
+    if (usePath && search.wasFound()) {
+        const std::vector<sf::Vector2f>& path = search.getPath();
+        while (pathIndex < path.size()) {
+            sf::Vector2f offset = path[pathIndex] - getCenter();
+            if (offset.x * offset.x + offset.y * offset.y > WAYPOINT_RADIUS * WAYPOINT_RADIUS) break;
+            ++pathIndex;
+        }
+        if (pathIndex < path.size()) waypoint = path[pathIndex];
     }
     
-    hasDetectedPlayer = false;
-    return false;
+    // Unreachable goals and guards wedged on a corner end the leg rather than stalling
+    sf::Vector2f before = position;
+    moveTowards(waypoint, deltaTime);
+    sf::Vector2f moved = position - before;
+    stalled = moved.x * moved.x + moved.y * moved.y <= 0.0001f;
+}
+
+void Guard::setRoomBounds(const sf::FloatRect& bounds) {
+    roomBounds = bounds;
+}
+
+void Guard::setCollisionMap(const CollisionMap* map) {
+    collisionMap = map;
+}
+
+void Guard::setPathScheduler(PathScheduler* scheduler) {
+    pathScheduler = scheduler;
+}
+
+void Guard::setTimerWheel(TimerWheel* wheel) {
+    timerWheel = wheel;
+}
+
+GuardState Guard::getState() const {
+    return state;
+}
+
+float Guard::getChaseSpeed() const {
+    return speed * CHASE_SPEED_SCALE;
+}
+
+bool Guard::canDetect() const {
+    return !coolingDown;
+}
+
+// Seen from the sprite's centre, not its top-left corner
+VisionCone Guard::getVisionCone() const {
+    return {getCenter(), facing, detectionRadius, std::cos(VISION_HALF_ANGLE)};
+}
+
+void Guard::onPlayerSpotted(const sf::Vector2f& playerCenter) {
+    if (timerWheel) {
+        coolingDown = true;
+        timerWheel->schedule(std::chrono::duration_cast<TimerWheel::Duration>(std::chrono::duration<float>(cooldownTime)),
+                             [this]() { coolingDown = false; });
+    }
+    alert(playerCenter);
 }
 
 bool Guard::checkCollision(const sf::FloatRect& bounds) {
@@ -119,28 +244,50 @@ sf::Vector2f Guard::getPosition() const {
     return position;
 }
 
+sf::Vector2f Guard::getCenter() const {
+    sf::FloatRect bounds = getBounds();
+    return bounds.position + bounds.size / 2.0f;
+}
+
 void Guard::setPosition(float x, float y) {
     position = {x, y};
     sprite.setPosition(position);
-    detectionCircle.setPosition(position);
 }
 
-void Guard::update(float deltaTime, const Player& player) {
-    if (detectionCooldown > 0) {
-        detectionCooldown -= deltaTime;
+void Guard::update(float deltaTime) {
+    if (chaseTimer > 0) {
+        chaseTimer -= deltaTime;
+    }
+    
+    switch (state) {
+        case GuardState::Patrol: patrol(deltaTime); break;
+        case GuardState::Chase: chase(deltaTime); break;
+        case GuardState::Investigate:
+        case GuardState::Return: followPath(deltaTime); break;
     }
-    patrol(deltaTime);
 }
 
-void Guard::draw(sf::RenderWindow& window, bool showDetectionRadius) {
-    if (showDetectionRadius) {
-        window.draw(detectionCircle);
+// Chase leads to Investigate, Investigate to Return, Return back to Patrol
+void Guard::think(const Player& player) {
+    switch (state) {
+        case GuardState::Patrol:
+            break;
+        case GuardState::Chase: {
+            sf::FloatRect playerBounds = player.getBounds();
+            lastKnownPlayerPosition = playerBounds.position + playerBounds.size / 2.0f;
+            if (chaseTimer <= 0.0f) startPath(lastKnownPlayerPosition, GuardState::Investigate);
+            break;
+        }
+        case GuardState::Investigate:
+            if (stalled) startPath(homePoint(), GuardState::Return);
+            break;
+        case GuardState::Return:
+            if (stalled) state = GuardState::Patrol;
+            break;
     }
-    window.draw(sprite);
 }
 
-float Guard::distanceTo(const sf::Vector2f& point) const {
-    float dx = point.x - position.x;
-    float dy = point.y - position.y;
-    return std::sqrt(dx * dx + dy * dy);
-}
\ No newline at end of file
+// The cone is drawn with the room's other cones (VisionOverlay)
+void Guard::draw(RenderQueue& queue) {
+    queue.submit(RenderLayer::Guards, sprite);
+}
@@ -4,8 +4,15 @@
 
 #include <SFML/Graphics.hpp>
 #include <vector>
+#include "Pathfinding.h"
+#include "Vision.h"
+#include "TimerWheel.h"
+#include "RenderQueue.h"
 
 class Player; // Forward declaration
+class CollisionMap;
+
+enum class GuardState { Patrol, Chase, Investigate, Return };
 
 class Guard {
 private:
@@ -18,15 +25,26 @@ private:
     int currentPatrolIndex;
     bool movingForward;
     
-    // Detection logic
+    // Detection logic - a cone along the direction of travel
     float detectionRadius;
-    bool hasDetectedPlayer;
-    float detectionCooldown; // Time before guard can detect again
+    sf::Vector2f facing; // Unit vector
+    bool coolingDown; // Can't detect again until the wheel timer clears this
     float cooldownTime;
+    TimerWheel* timerWheel; // nullptr = no cooldown
+    
+    // Pursuit - chase the player over a shared flow field, then walk (A*) to where
+    // they were last seen, then back to the patrol route
+    GuardState state;
+    float chaseTimer;
+    sf::Vector2f lastKnownPlayerPosition;
+    AStarSearch search;
+    std::size_t pathIndex;
+    bool stalled; // Path leg ended or blocked; think() picks the next one
+    PathScheduler* pathScheduler; // nullptr = no pathfinding, steer straight
     
     // Visuals
-    sf::CircleShape detectionCircle;
     sf::FloatRect roomBounds;
+    const CollisionMap* collisionMap; // Room geometry to slide along (nullptr = none)
     
 public:
     // Constructor - CHANGED: Takes Texture
@@ -36,24 +54,44 @@ public:
     void addPatrolPoint(float x, float y);
     void setPatrolPoints(const std::vector<sf::Vector2f>& points);
     void setRoomBounds(const sf::FloatRect& bounds);
+    void setCollisionMap(const CollisionMap* map);
+    void setPathScheduler(PathScheduler* scheduler);
+    void setTimerWheel(TimerWheel* wheel);
     
     // AI Logic
     void patrol(float deltaTime);
-    bool detectPlayer(const Player& player);
-    void update(float deltaTime, const Player& player);
+    bool canDetect() const; // False while cooling down after a detection
+    VisionCone getVisionCone() const;
+    void onPlayerSpotted(const sf::Vector2f& playerCenter);
+    void alert(const sf::Vector2f& playerPosition); // Start chasing
+    void loseTrail(); // Stop chasing and go back to patrolling
+    GuardState getState() const;
+    float getChaseSpeed() const;
+    
+    // Split so the AIScheduler can spread the costly part across frames:
+    // update() integrates motion every tick, think() makes the decisions
+    // (chase target, path replans, state changes) whenever it gets a turn
+    void update(float deltaTime);
+    void think(const Player& player);
     
     // Rendering
-    void draw(sf::RenderWindow& window, bool showDetectionRadius = true);
+    void draw(RenderQueue& queue);
     
     // Utilities
     bool checkCollision(const sf::FloatRect& bounds);
     sf::FloatRect getBounds() const;
     sf::Vector2f getPosition() const;
+    sf::Vector2f getCenter() const;
     void setPosition(float x, float y);
     
 private:
     void moveTowards(const sf::Vector2f& target, float deltaTime);
-    float distanceTo(const sf::Vector2f& point) const;
+    void moveBy(const sf::Vector2f& step);
+    void chase(float deltaTime);
+    void followPath(float deltaTime);
+    void startPath(const sf::Vector2f& target, GuardState nextState);
+    void faceFirstLeg();
+    sf::Vector2f homePoint() const;
 };
 
 #endif // GUARD_H
\ No newline at end of file
@@ -0,0 +1,41 @@
+/*
+ * Museum Escape - HUD Text Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "Hud.h"
+
+HudText::HudText(const sf::Font& font) : text(font), dirty(false) {}
+
+void HudText::set(std::string_view newValue) {
+    if (newValue.size() > CAPACITY) newValue = newValue.substr(0, CAPACITY);
+    if (newValue == value.view()) return;
+    value.clear().append(newValue);
+    dirty = true;
+}
+
+std::string_view HudText::get() const { return value.view(); }
+
+bool HudText::isDirty() const { return dirty; }
+
+sf::Text& HudText::getText() { return text; }
+
+void HudText::draw(RenderQueue& queue) {
+    if (dirty) layOut();
+    if (!value.view().empty()) queue.submit(RenderLayer::HudText, text);
+}
+
+void HudText::layOut() {
+    std::string_view characters = value.view();
+    bool ascii = true;
+    for (char character : characters) ascii = ascii && static_cast<unsigned char>(character) < 0x80;
+    
+    if (ascii && shown.getSize() == characters.size()) {
+        // Same length: overwrite in place, and text copies into the capacity it already has
+        for (std::size_t i = 0; i < characters.size(); ++i) shown[i] = static_cast<unsigned char>(characters[i]);
+    } else {
+        shown = sf::String::fromUtf8(characters.begin(), characters.end());
+    }
+    text.setString(shown);
+    dirty = false;
+}
@@ -0,0 +1,80 @@
+#ifndef HUD_H
+#define HUD_H
+
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include "RenderQueue.h"
+
+// FixedText - text built in a fixed inline buffer, for formatting HUD values
+// without touching the heap. Anything past Capacity is cut off.
+template<std::size_t Capacity>
+class FixedText {
+private:
+    std::array<char, Capacity> buffer;
+    std::size_t length = 0;
+
+public:
+    FixedText& clear() {
+        length = 0;
+        return *this;
+    }
+
+    FixedText& append(std::string_view text) {
+        for (char character : text) {
+            if (length == Capacity) break;
+            buffer[length++] = character;
+        }
+        return *this;
+    }
+
+    // Decimal, left-padded with fill to at least minWidth characters
+    FixedText& appendNumber(long value, std::size_t minWidth = 0, char fill = '0') {
+        char digits[24];
+        std::size_t count = 0;
+        unsigned long magnitude = value < 0 ? 0ul - static_cast<unsigned long>(value) : static_cast<unsigned long>(value);
+        do {
+            digits[count++] = static_cast<char>('0' + magnitude % 10);
+            magnitude /= 10;
+        } while (magnitude != 0);
+        if (value < 0) digits[count++] = '-';
+        for (std::size_t pad = count; pad < minWidth; ++pad) append(std::string_view(&fill, 1));
+        while (count > 0) append(std::string_view(&digits[--count], 1));
+        return *this;
+    }
+
+    std::string_view view() const { return {buffer.data(), length}; }
+};
+
+// HudText - one on-screen value (timer, room name, notification, inventory
+// line). set() only marks it dirty when the value actually changes; draw()
+// lays the text out again only then. A new value of the same length is
+// written into the existing string in place, so a ticking clock never
+// allocates.
+class HudText {
+public:
+    static constexpr std::size_t CAPACITY = 128;
+
+private:
+    sf::Text text;
+    sf::String shown;           // What text holds
+    FixedText<CAPACITY> value;  // Latest value
+    bool dirty;
+
+public:
+    explicit HudText(const sf::Font& font);
+
+    void set(std::string_view newValue);
+    std::string_view get() const;
+    bool isDirty() const;
+
+    sf::Text& getText(); // Styling - font, size, position, colours
+
+    void draw(RenderQueue& queue); // Lays the text out first if it changed
+
+private:
+    void layOut();
+};
+
+#endif // HUD_H
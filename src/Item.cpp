@@ -6,24 +6,33 @@
 
 #include "Item.h"
 
+ToolType toolTypeFromString(const std::string& type) {
+    if (type == "flashlight") return ToolType::Flashlight;
+    if (type == "bolt_cutters") return ToolType::BoltCutters;
+    return ToolType::Other;
+}
+
 // Item Constructor
-Item::Item(const std::string& itemName, const std::string& desc, float x, float y)
-    : name(itemName), description(desc), position(x, y), isCollected(false) {
+Item::Item(const std::string& itemName, const std::string& desc, float x, float y, ItemKind itemKind)
+    : name(itemName), id(internItemID(itemName)), description(desc), position(x, y), isCollected(false), kind(itemKind) {
     sprite.setSize({20.0f, 20.0f});
     sprite.setPosition(position);
     sprite.setFillColor(sf::Color::Yellow);
 }
 
 std::string Item::getName() const { return name; }
+ItemID Item::getID() const { return id; }
+ItemKind Item::getKind() const { return kind; }
+ItemID Item::getKeyID() const { return INVALID_ITEM_ID; }
 std::string Item::getDescription() const { return description; }
 sf::Vector2f Item::getPosition() const { return position; }
 bool Item::isItemCollected() const { return isCollected; }
 sf::FloatRect Item::getBounds() const { return sprite.getGlobalBounds(); }
 
 void Item::collect() { isCollected = true; }
-void Item::draw(sf::RenderWindow& window) { 
+void Item::draw(RenderQueue& queue) { 
     if (!isCollected) {
-        window.draw(sprite); 
+        queue.submit(RenderLayer::Markers, sprite); 
     }
 }
 bool Item::checkCollision(const sf::FloatRect& bounds) {
@@ -32,16 +41,17 @@ bool Item::checkCollision(const sf::FloatRect& bounds) {
 
 // Key Constructor
 Key::Key(const std::string& keyName, const std::string& doorIdentifier, float x, float y)
-    : Item(keyName, "A key to unlock doors", x, y), doorID(doorIdentifier) {
+    : Item(keyName, "A key to unlock doors", x, y, ItemKind::Key), doorID(doorIdentifier), doorKeyID(internItemID(doorIdentifier)) {
     sprite.setFillColor(sf::Color::Cyan); // Keys are cyan
 }
 
 void Key::use() {}
 std::string Key::getDoorID() const { return doorID; }
+ItemID Key::getKeyID() const { return doorKeyID; }
 
 // Passcode Constructor
 Passcode::Passcode(const std::string& passcodeName, const std::string& codeValue, float x, float y)
-    : Item(passcodeName, "A numeric passcode", x, y), code(codeValue) {
+    : Item(passcodeName, "A numeric passcode", x, y, ItemKind::Passcode), code(codeValue) {
     sprite.setFillColor(sf::Color::Magenta); // Passcodes are magenta
 }
 
@@ -64,11 +74,11 @@ void BasicItem::use() {
 
 // Tool Constructor
 Tool::Tool(const std::string& toolName, const std::string& type, const std::string& desc, float x, float y)
-    : Item(toolName, desc, x, y), toolType(type), isActive(false) {
+    : Item(toolName, desc, x, y, ItemKind::Tool), toolType(type), toolKind(toolTypeFromString(type)), isActive(false) {
     // Different colors for different tools
-    if (type == "flashlight") {
+    if (toolKind == ToolType::Flashlight) {
         sprite.setFillColor(sf::Color(255, 255, 150)); // Light yellow for flashlight
-    } else if (type == "bolt_cutters") {
+    } else if (toolKind == ToolType::BoltCutters) {
         sprite.setFillColor(sf::Color(150, 150, 150)); // Gray for bolt cutters
     } else {
         sprite.setFillColor(sf::Color(100, 200, 255)); // Light blue for other tools
@@ -83,6 +93,10 @@ std::string Tool::getToolType() const {
     return toolType;
 }
 
+ToolType Tool::getToolKind() const {
+    return toolKind;
+}
+
 void Tool::activate() {
     isActive = true;
 }
@@ -101,104 +115,161 @@ bool Tool::isToolActive() const {
 
 // Inventory Constructor (increased capacity to 15)
 Inventory::Inventory(int capacity)
-    : maxCapacity(capacity), isVisible(false), background({400.0f, 500.0f}) {
+    : kindCounts{}, toolCounts{}, kindMask(0), toolMask(0),
+      maxCapacity(capacity), background({400.0f, 500.0f}), isVisible(false),
+      title(font), emptyText(font), linesDirty(true) {
     background.setFillColor(sf::Color(0, 0, 0, 200));
     background.setOutlineThickness(3.0f);
     background.setOutlineColor(sf::Color::White);
     background.setPosition({200.0f, 50.0f});
+    
+    title.set("INVENTORY");
+    title.getText().setCharacterSize(24);
+    title.getText().setFillColor(sf::Color::White);
+    title.getText().setPosition({350.0f, 70.0f});
+    emptyText.set("No items");
+    emptyText.getText().setCharacterSize(18);
+    emptyText.getText().setFillColor(sf::Color(150, 150, 150));
+    emptyText.getText().setPosition({220.0f, 110.0f});
 }
 
-bool Inventory::addItem(std::shared_ptr<Item> item) {
+bool Inventory::addItem(Item* item) {
     if (items.size() < static_cast<size_t>(maxCapacity)) {
+        std::size_t slot = items.size();
         items.push_back(item);
+        itemIndex.emplace(item->getID(), slot);
+        if (item->getKeyID() != INVALID_ITEM_ID) keyIndex.emplace(item->getKeyID(), slot);
+        countItem(*item, +1);
+        linesDirty = true;
         return true;
     }
     return false;
 }
 
+bool Inventory::removeItem(ItemID itemID) {
+    auto found = itemIndex.find(itemID);
+    if (found == itemIndex.end()) return false;
+    
+    // Keep display order; removal is rare so re-indexing the tail is fine
+    countItem(*items[found->second], -1);
+    items.erase(items.begin() + found->second);
+    rebuildIndex();
+    linesDirty = true;
+    return true;
+}
+
 bool Inventory::removeItem(const std::string& itemName) {
-    for (auto it = items.begin(); it != items.end(); ++it) {
-        if ((*it)->getName() == itemName) {
-            items.erase(it);
-            return true;
-        }
-    }
-    return false;
+    return removeItem(hashItemID(itemName));
+}
+
+bool Inventory::hasItem(ItemID itemID) const {
+    return itemIndex.find(itemID) != itemIndex.end();
 }
 
 bool Inventory::hasItem(const std::string& itemName) const {
-    for (const auto& item : items) {
-        if (item->getName() == itemName) return true;
-    }
-    return false;
+    return hasItem(hashItemID(itemName));
+}
+
+Item* Inventory::getItem(ItemID itemID) {
+    auto found = itemIndex.find(itemID);
+    return found != itemIndex.end() ? items[found->second] : nullptr;
+}
+
+Item* Inventory::getItem(const std::string& itemName) {
+    return getItem(hashItemID(itemName));
+}
+
+bool Inventory::hasKey(ItemID doorKeyID) const {
+    return keyIndex.find(doorKeyID) != keyIndex.end();
 }
 
-std::shared_ptr<Item> Inventory::getItem(const std::string& itemName) {
-    for (auto& item : items) {
-        if (item->getName() == itemName) return item;
+void Inventory::rebuildIndex() {
+    itemIndex.clear();
+    keyIndex.clear();
+    for (std::size_t slot = 0; slot < items.size(); ++slot) {
+        itemIndex.emplace(items[slot]->getID(), slot);
+        if (items[slot]->getKeyID() != INVALID_ITEM_ID) keyIndex.emplace(items[slot]->getKeyID(), slot);
     }
-    return nullptr;
 }
 
 // NEW: Check if player has a specific tool type
 bool Inventory::hasTool(const std::string& toolType) const {
-    for (const auto& item : items) {
-        // Try to cast to Tool
-        Tool* tool = dynamic_cast<Tool*>(item.get());
-        if (tool && tool->getToolType() == toolType) {
-            return true;
-        }
+    // Known tools are a mask test; Other covers many names, so match those exactly
+    ToolType kind = toolTypeFromString(toolType);
+    if (kind != ToolType::Other) return hasTool(kind);
+    for (const Item* item : items) {
+        if (item->getKind() == ItemKind::Tool && static_cast<const Tool*>(item)->getToolType() == toolType) return true;
     }
     return false;
 }
 
+// Keep per-kind counts and bitmasks in step with add/remove
+void Inventory::countItem(const Item& item, int delta) {
+    std::size_t kindSlot = static_cast<std::size_t>(item.getKind());
+    kindCounts[kindSlot] = static_cast<std::uint8_t>(kindCounts[kindSlot] + delta);
+    if (kindCounts[kindSlot] > 0) kindMask |= 1u << kindSlot;
+    else kindMask &= ~(1u << kindSlot);
+    
+    if (item.getKind() == ItemKind::Tool) {
+        std::size_t toolSlot = static_cast<std::size_t>(static_cast<const Tool&>(item).getToolKind());
+        toolCounts[toolSlot] = static_cast<std::uint8_t>(toolCounts[toolSlot] + delta);
+        if (toolCounts[toolSlot] > 0) toolMask |= 1u << toolSlot;
+        else toolMask &= ~(1u << toolSlot);
+    }
+}
+
 int Inventory::getItemCount() const { return static_cast<int>(items.size()); }
 int Inventory::getMaxCapacity() const { return maxCapacity; }
 bool Inventory::isFull() const { return items.size() >= static_cast<size_t>(maxCapacity); }
-std::vector<std::shared_ptr<Item>>& Inventory::getItems() { return items; }
+std::vector<Item*>& Inventory::getItems() { return items; }
 
 void Inventory::toggleVisibility() { isVisible = !isVisible; }
 void Inventory::setVisible(bool visible) { isVisible = visible; }
 bool Inventory::getVisible() const { return isVisible; }
-void Inventory::setFont(const sf::Font& f) { font = f; }
+void Inventory::setFont(const sf::Font& f) {
+    font = f;
+    title.getText().setFont(font);
+    emptyText.getText().setFont(font);
+    for (HudText& line : lines) line.getText().setFont(font);
+}
 
-void Inventory::draw(sf::RenderWindow& window) {
+void Inventory::draw(RenderQueue& queue) {
     if (!isVisible) return;
+    if (linesDirty) updateLines();
     
-    window.draw(background);
-    
-    sf::Text title(font);
-    title.setString("INVENTORY");
-    title.setCharacterSize(24);
-    title.setFillColor(sf::Color::White);
-    title.setPosition({350.0f, 70.0f});
-    window.draw(title);
-    
+    queue.submit(RenderLayer::HudPanels, background);
+    title.draw(queue);
+    for (HudText& line : lines) line.draw(queue);
+    if (items.empty()) emptyText.draw(queue);
+}
+
+// "1. Flashlight", ... - a line whose text is unchanged keeps its layout
+void Inventory::updateLines() {
     float yPos = 110.0f;
-    int index = 1;
-    
-    for (const auto& item : items) {
-        sf::Text itemText(font);
-        itemText.setString(std::to_string(index) + ". " + item->getName());
-        itemText.setCharacterSize(18);
-        itemText.setFillColor(sf::Color::White);
-        itemText.setPosition({220.0f, yPos});
-        window.draw(itemText);
-        
-        yPos += 30.0f;
-        index++;
+    while (lines.size() < items.size()) {
+        lines.emplace_back(font);
+        sf::Text& text = lines.back().getText();
+        text.setCharacterSize(18);
+        text.setFillColor(sf::Color::White);
+        text.setPosition({220.0f, yPos + 30.0f * (lines.size() - 1)});
     }
+    lines.erase(lines.begin() + items.size(), lines.end());
     
-    if (items.empty()) {
-        sf::Text emptyText(font);
-        emptyText.setString("No items");
-        emptyText.setCharacterSize(18);
-        emptyText.setFillColor(sf::Color(150, 150, 150));
-        emptyText.setPosition({220.0f, 110.0f});
-        window.draw(emptyText);
+    for (std::size_t i = 0; i < items.size(); ++i) {
+        FixedText<HudText::CAPACITY> label;
+        label.appendNumber(static_cast<long>(i + 1)).append(". ").append(items[i]->getName());
+        lines[i].set(label.view());
     }
+    linesDirty = false;
 }
 
 void Inventory::clear() {
     items.clear();
+    linesDirty = true;
+    itemIndex.clear();
+    keyIndex.clear();
+    kindCounts.fill(0);
+    toolCounts.fill(0);
+    kindMask = 0;
+    toolMask = 0;
 }
\ No newline at end of file
@@ -4,24 +4,41 @@
 #include <SFML/Graphics.hpp>
 #include <string>
 #include <vector>
-#include <memory>
+#include <unordered_map>
+#include <array>
+#include <cstdint>
+#include "ItemID.h"
+#include "Hud.h"
+
+// Compact type tag - lets the inventory index items without dynamic_cast
+enum class ItemKind : std::uint8_t { Basic, Key, Passcode, Tool, Count };
+
+// Known tool types ("flashlight", "bolt_cutters", ...)
+enum class ToolType : std::uint8_t { Flashlight, BoltCutters, Other, Count };
+
+ToolType toolTypeFromString(const std::string& type);
 
 // Base Item class
 class Item {
 protected:
     std::string name;
+    ItemID id; // Interned hash of name
     std::string description;
     sf::Vector2f position;
     sf::RectangleShape sprite;
     bool isCollected;
+    ItemKind kind;
     
 public:
     // Constructor
-    Item(const std::string& itemName, const std::string& desc, float x, float y);
+    Item(const std::string& itemName, const std::string& desc, float x, float y, ItemKind itemKind = ItemKind::Basic);
     virtual ~Item() = default;
     
     // Getters
     std::string getName() const;
+    ItemID getID() const;
+    ItemKind getKind() const;
+    virtual ItemID getKeyID() const; // Door key this item opens (INVALID_ITEM_ID if none)
     std::string getDescription() const;
     sf::Vector2f getPosition() const;
     bool isItemCollected() const;
@@ -32,7 +49,7 @@ public:
     virtual void use() = 0; // Pure virtual - each item type has unique use
     
     // Rendering
-    void draw(sf::RenderWindow& window);
+    void draw(RenderQueue& queue);
     
     // Collision
     bool checkCollision(const sf::FloatRect& bounds);
@@ -42,12 +59,14 @@ public:
 class Key : public Item {
 private:
     std::string doorID; // Which door this key unlocks
+    ItemID doorKeyID;   // Interned hash of doorID
     
 public:
     Key(const std::string& keyName, const std::string& doorIdentifier, float x, float y);
     
     void use() override;
     std::string getDoorID() const;
+    ItemID getKeyID() const override;
 };
 
 // Passcode item - Used for digital locks
@@ -74,6 +93,7 @@ public:
 class Tool : public Item {
 private:
     std::string toolType; // "flashlight", "bolt_cutters", etc.
+    ToolType toolKind;
     bool isActive;
     
 public:
@@ -81,6 +101,7 @@ public:
     
     void use() override;
     std::string getToolType() const;
+    ToolType getToolKind() const;
     void activate();
     void deactivate();
     bool isToolActive() const;
@@ -89,28 +110,51 @@ public:
 // Inventory class - Manages player's collected items
 class Inventory {
 private:
-    std::vector<std::shared_ptr<Item>> items;
+    std::vector<Item*> items; // Non-owning - items live in the level arena
+    std::unordered_map<ItemID, std::size_t> itemIndex; // Item ID -> slot in items
+    std::unordered_map<ItemID, std::size_t> keyIndex;  // Door key ID -> slot in items
+    
+    // Per-kind counts with matching bitmasks (bit set while count > 0)
+    std::array<std::uint8_t, static_cast<std::size_t>(ItemKind::Count)> kindCounts;
+    std::array<std::uint8_t, static_cast<std::size_t>(ToolType::Count)> toolCounts;
+    std::uint32_t kindMask;
+    std::uint32_t toolMask;
     int maxCapacity;
     sf::Font font;
     sf::RectangleShape background;
     bool isVisible;
     
+    // Panel text, re-laid out only after the contents change
+    HudText title;
+    HudText emptyText;
+    std::vector<HudText> lines; // One per item
+    bool linesDirty;
+    
 public:
     // Constructor
     Inventory(int capacity = 15); // Increased capacity for more items
     
     // Item management
-    bool addItem(std::shared_ptr<Item> item);
+    bool addItem(Item* item);
+    bool removeItem(ItemID itemID);
     bool removeItem(const std::string& itemName);
+    bool hasItem(ItemID itemID) const;
     bool hasItem(const std::string& itemName) const;
-    std::shared_ptr<Item> getItem(const std::string& itemName);
+    Item* getItem(ItemID itemID);
+    Item* getItem(const std::string& itemName);
+    bool hasKey(ItemID doorKeyID) const; // Holding a key for this door?
     bool hasTool(const std::string& toolType) const; // NEW: Check for specific tool
     
+    // Bitmask queries - cheap enough to call every frame
+    bool hasTool(ToolType type) const { return (toolMask >> static_cast<unsigned>(type)) & 1u; }
+    bool hasKind(ItemKind itemKind) const { return (kindMask >> static_cast<unsigned>(itemKind)) & 1u; }
+    bool hasAnyKey() const { return hasKind(ItemKind::Key); }
+    
     // Inventory properties
     int getItemCount() const;
     int getMaxCapacity() const;
     bool isFull() const;
-    std::vector<std::shared_ptr<Item>>& getItems();
+    std::vector<Item*>& getItems();
     
     // Display
     void toggleVisibility();
@@ -119,10 +163,15 @@ public:
     void setFont(const sf::Font& f);
     
     // Rendering
-    void draw(sf::RenderWindow& window);
+    void draw(RenderQueue& queue);
     
     // Clear inventory
     void clear();
+    
+private:
+    void rebuildIndex();
+    void countItem(const Item& item, int delta);
+    void updateLines();
 };
 
 #endif // ITEM_H
\ No newline at end of file
@@ -0,0 +1,33 @@
+/*
+ * Museum Escape - Item ID Interning
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "ItemID.h"
+#include <unordered_map>
+#include <stdexcept>
+
+namespace {
+    // Function-local so it is ready before any static Item is constructed
+    std::unordered_map<ItemID, std::string>& idNames() {
+        static std::unordered_map<ItemID, std::string> names;
+        return names;
+    }
+}
+
+ItemID internItemID(const std::string& name) {
+    ItemID id = hashItemID(name);
+    if (id == INVALID_ITEM_ID) return id;
+
+    auto result = idNames().emplace(id, name);
+    if (!result.second && result.first->second != name) {
+        throw std::runtime_error("Item ID collision: \"" + name + "\" and \"" + result.first->second + "\"");
+    }
+    return id;
+}
+
+const std::string& getItemIDName(ItemID id) {
+    static const std::string unknown = "<unknown>";
+    auto it = idNames().find(id);
+    return it != idNames().end() ? it->second : unknown;
+}
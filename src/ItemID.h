@@ -0,0 +1,36 @@
+#ifndef ITEMID_H
+#define ITEMID_H
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Compact identifier for items, tools and door keys.
+// An ID is the FNV-1a hash of the name, so it can be computed at compile time
+// ("Evidence File"_id) and per-frame checks become integer compares.
+using ItemID = std::uint32_t;
+
+constexpr ItemID INVALID_ITEM_ID = 0;
+
+constexpr ItemID hashItemID(std::string_view name) {
+    if (name.empty()) return INVALID_ITEM_ID;
+
+    std::uint32_t hash = 2166136261u;
+    for (char c : name) {
+        hash ^= static_cast<std::uint8_t>(c);
+        hash *= 16777619u;
+    }
+    return hash == INVALID_ITEM_ID ? 1u : hash; // 0 is reserved for "no item"
+}
+
+constexpr ItemID operator""_id(const char* name, std::size_t length) {
+    return hashItemID(std::string_view(name, length));
+}
+
+// Interning - registers the name behind an ID (for UI/debug output) and
+// throws if two different names hash to the same ID
+ItemID internItemID(const std::string& name);
+const std::string& getItemIDName(ItemID id);
+
+#endif // ITEMID_H
@@ -0,0 +1,224 @@
+/*
+ * Museum Escape - Job System Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "JobSystem.h"
+#include <algorithm>
+
+namespace {
+    // Which queue the current thread owns; 0 for the main thread (and any other outsider)
+    thread_local std::size_t currentQueue = 0;
+
+    // Starting ring size per queue (a parallelFor queues at most one job per worker);
+    // a queue only grows if submitters keep more than this waiting
+    const std::size_t INITIAL_QUEUE_CAPACITY = 16;
+}
+
+// ============================================================================
+// Job
+// ============================================================================
+
+Job::Job(void (*work)(void* context), void* workContext)
+    : task(work), context(workContext), blockers(1), finished(false), ran(false), dependents(nullptr), linkCount(0) {}
+
+bool Job::runsAfter(Job& prerequisite) {
+    if (linkCount == MAX_PREREQUISITES) return false;
+    std::lock_guard<std::mutex> lock(prerequisite.mutex);
+    if (prerequisite.ran) return true;
+    Link& link = links[linkCount++];
+    link.dependent = this;
+    link.next = prerequisite.dependents;
+    prerequisite.dependents = &link;
+    blockers.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void Job::reset() {
+    blockers.store(1, std::memory_order_relaxed);
+    finished.store(false, std::memory_order_relaxed);
+    ran = false;
+    dependents = nullptr;
+    linkCount = 0;
+}
+
+bool Job::isFinished() const { return finished.load(std::memory_order_acquire); }
+
+// ============================================================================
+// WorkQueue
+// ============================================================================
+
+void JobSystem::WorkQueue::pushBack(Job* job) {
+    if (count == ring.size()) {
+        // Unwrap into a ring twice the size
+        std::vector<Job*> grown(std::max<std::size_t>(ring.size() * 2, INITIAL_QUEUE_CAPACITY));
+        for (std::size_t i = 0; i < count; ++i) grown[i] = ring[(head + i) % ring.size()];
+        ring.swap(grown);
+        head = 0;
+    }
+    ring[(head + count) % ring.size()] = job;
+    ++count;
+}
+
+Job* JobSystem::WorkQueue::popBack() {
+    if (count == 0) return nullptr;
+    --count;
+    return ring[(head + count) % ring.size()];
+}
+
+Job* JobSystem::WorkQueue::popFront() {
+    if (count == 0) return nullptr;
+    Job* job = ring[head];
+    head = (head + 1) % ring.size();
+    --count;
+    return job;
+}
+
+// ============================================================================
+// JobSystem
+// ============================================================================
+
+JobSystem::JobSystem(unsigned workerCount) : loopBusy(false), queuedCount(0), stopping(false) {
+    if (workerCount == 0) {
+        unsigned cores = std::thread::hardware_concurrency();
+        workerCount = cores > 1 ? cores - 1 : 0;
+    }
+    for (unsigned i = 0; i < workerCount; ++i) helpers.push_back(std::make_unique<Job>(&JobSystem::drainLoop, this));
+    loop.body = nullptr;
+    loop.context = nullptr;
+    loop.count = 0;
+    loop.grain = 1;
+    loop.next = 0;
+
+    for (unsigned i = 0; i <= workerCount; ++i) {
+        queues.push_back(std::make_unique<WorkQueue>());
+        queues.back()->ring.resize(INITIAL_QUEUE_CAPACITY);
+        queues.back()->head = 0;
+        queues.back()->count = 0;
+    }
+    for (unsigned i = 1; i <= workerCount; ++i) workers.emplace_back(&JobSystem::workerLoop, this, i);
+}
+
+JobSystem::~JobSystem() {
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (std::thread& worker : workers) worker.join();
+}
+
+void JobSystem::submit(Job& job) {
+    // Drop the "not submitted yet" blocker; whoever drops the last one schedules it
+    if (job.blockers.fetch_sub(1, std::memory_order_acq_rel) == 1) schedule(&job);
+}
+
+void JobSystem::schedule(Job* job) {
+    WorkQueue& queue = *queues[currentQueue];
+    {
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        queue.pushBack(job);
+    }
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        queuedCount.fetch_add(1, std::memory_order_release);
+    }
+    wake.notify_one();
+}
+
+void JobSystem::wait(const Job& job) {
+    while (!job.isFinished()) {
+        if (!runOne(currentQueue)) std::this_thread::yield();
+    }
+}
+
+void JobSystem::runLoop(std::size_t count, std::size_t grain, RangeFunction body, const void* context) {
+    grain = std::max<std::size_t>(grain, 1);
+    std::size_t chunks = (count + grain - 1) / grain;
+    if (chunks <= 1 || workers.empty() || loopBusy.exchange(true, std::memory_order_acquire)) {
+        if (count > 0) body(context, 0, count);
+        return;
+    }
+
+    // One job per thread, each pulling chunks off a shared counter until the range
+    // is used up - uneven chunks balance themselves without a job per chunk
+    loop.body = body;
+    loop.context = context;
+    loop.count = count;
+    loop.grain = grain;
+    loop.next.store(0, std::memory_order_relaxed);
+
+    std::size_t helperCount = std::min<std::size_t>(chunks - 1, workers.size());
+    for (std::size_t i = 0; i < helperCount; ++i) {
+        helpers[i]->reset();
+        submit(*helpers[i]);
+    }
+    drainLoop(this);
+    for (std::size_t i = 0; i < helperCount; ++i) wait(*helpers[i]);
+    loopBusy.store(false, std::memory_order_release);
+}
+
+void JobSystem::drainLoop(void* system) {
+    Loop& loop = static_cast<JobSystem*>(system)->loop;
+    for (std::size_t begin = loop.next.fetch_add(loop.grain); begin < loop.count; begin = loop.next.fetch_add(loop.grain)) {
+        loop.body(loop.context, begin, std::min(loop.count, begin + loop.grain));
+    }
+}
+
+unsigned JobSystem::getWorkerCount() const { return static_cast<unsigned>(workers.size()); }
+unsigned JobSystem::getThreadCount() const { return static_cast<unsigned>(workers.size()) + 1; }
+
+void JobSystem::workerLoop(std::size_t index) {
+    currentQueue = index;
+    while (!stopping.load(std::memory_order_acquire)) {
+        if (runOne(index)) continue;
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wake.wait(lock, [this]() { return stopping.load() || queuedCount.load() > 0; });
+    }
+}
+
+bool JobSystem::runOne(std::size_t index) {
+    Job* job = nullptr;
+    {
+        // Own work newest-first: it is the most likely to still be in cache
+        WorkQueue& queue = *queues[index];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        job = queue.popBack();
+    }
+    if (!job) job = steal(index);
+    if (!job) return false;
+
+    queuedCount.fetch_sub(1, std::memory_order_acq_rel);
+    job->task(job->context);
+    finish(job);
+    return true;
+}
+
+// Oldest job of the first other queue that has one
+Job* JobSystem::steal(std::size_t thief) {
+    for (std::size_t offset = 1; offset < queues.size(); ++offset) {
+        WorkQueue& queue = *queues[(thief + offset) % queues.size()];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (Job* job = queue.popFront()) return job;
+    }
+    return nullptr;
+}
+
+void JobSystem::finish(Job* job) {
+    Job::Link* ready;
+    {
+        std::lock_guard<std::mutex> lock(job->mutex);
+        job->ran = true;
+        ready = job->dependents;
+        job->dependents = nullptr;
+    }
+    // Last touch of the job itself: once this is set its owner may destroy or
+    // reuse it. The links live in the dependents, which can't run until released
+    job->finished.store(true, std::memory_order_release);
+    while (ready) {
+        // Read the link before releasing its job - it may run (and be gone) right after
+        Job* dependent = ready->dependent;
+        ready = ready->next;
+        if (dependent->blockers.fetch_sub(1, std::memory_order_acq_rel) == 1) schedule(dependent);
+    }
+}
@@ -0,0 +1,144 @@
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// One unit of work: a function and a context pointer, run once submitted and
+// all its prerequisites have finished. Owned by whoever submits it (like an
+// AStarSearch handed to the PathScheduler) and must stay alive until it has
+// finished. Dependencies need no allocation: each job carries the links that
+// hook it onto up to MAX_PREREQUISITES prerequisites; fan in further through
+// an intermediate job.
+class Job {
+public:
+    static constexpr std::size_t MAX_PREREQUISITES = 4;
+
+private:
+    struct Link {
+        Job* dependent;
+        Link* next;
+    };
+
+    void (*task)(void* context);
+    void* context;
+    std::atomic<int> blockers;  // Unfinished prerequisites, +1 until submitted
+    std::atomic<bool> finished;
+    std::mutex mutex;           // Guards ran/dependents against a racing finish
+    bool ran;                   // Task done; no new dependents accepted
+    Link* dependents;           // Jobs waiting on this one (their links)
+    Link links[MAX_PREREQUISITES];
+    std::size_t linkCount;
+
+public:
+    Job(void (*work)(void* context), void* workContext);
+
+    // Runs callable() - which is only referenced, so it must outlive the job
+    template<typename Callable, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Callable>, Job>>>
+    explicit Job(Callable& callable)
+        : Job([](void* target) { (*static_cast<Callable*>(target))(); }, &callable) {}
+
+    Job(const Job&) = delete;
+    Job& operator=(const Job&) = delete;
+
+    // Don't start before 'prerequisite' has finished. Call before submitting
+    // this job; the prerequisite may already be running (or done). False if
+    // this job already has MAX_PREREQUISITES.
+    bool runsAfter(Job& prerequisite);
+
+    // Make a finished (or never submitted) job ready to set up and submit again
+    void reset();
+
+    bool isFinished() const;
+
+    friend class JobSystem;
+};
+
+// JobSystem - a worker per spare core, each with its own queue. Workers push
+// and pop their own work at the back and steal from the front of the others'
+// when they run dry, so jobs spawned by a job stay on the core that made them.
+// A thread that waits helps run jobs instead of blocking.
+//
+// Nothing is allocated per job: jobs belong to their submitters, the queues'
+// storage is reused, and parallelFor keeps its helper jobs in the JobSystem
+// and passes its body as a function pointer plus context.
+class JobSystem {
+private:
+    using RangeFunction = void (*)(const void* context, std::size_t begin, std::size_t end);
+
+    // Ring of queued jobs; grows (by doubling) only if it ever fills up
+    struct WorkQueue {
+        std::mutex mutex;
+        std::vector<Job*> ring;
+        std::size_t head;
+        std::size_t count;
+
+        void pushBack(Job* job);
+        Job* popBack();  // nullptr if empty
+        Job* popFront(); // nullptr if empty
+    };
+
+    // The parallelFor in flight; its helpers all drain this one
+    struct Loop {
+        RangeFunction body;
+        const void* context;
+        std::size_t count;
+        std::size_t grain;
+        std::atomic<std::size_t> next;
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> queues; // [0] = threads outside the pool
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<Job>> helpers; // One per worker, reused by every parallelFor
+    Loop loop;
+    std::atomic<bool> loopBusy;     // A parallelFor is using helpers/loop
+    std::atomic<int> queuedCount;
+    std::atomic<bool> stopping;
+    std::mutex sleepMutex;
+    std::condition_variable wake;
+
+public:
+    // 0 = one worker per core, less the calling thread
+    explicit JobSystem(unsigned workerCount = 0);
+    ~JobSystem();
+
+    JobSystem(const JobSystem&) = delete;
+    JobSystem& operator=(const JobSystem&) = delete;
+
+    // Queue the job; it runs once all its prerequisites have finished
+    void submit(Job& job);
+
+    // Run other jobs on this thread until 'job' has finished (it must have been submitted)
+    void wait(const Job& job);
+
+    // body(begin, end) over [0, count) in chunks of at least 'grain', on every
+    // core; returns when all are done. Small ranges just run on the caller, as
+    // does a parallelFor started while another is running (from a job, say).
+    // body is only referenced, never copied.
+    template<typename Body>
+    void parallelFor(std::size_t count, std::size_t grain, const Body& body) {
+        runLoop(count, grain, [](const void* context, std::size_t begin, std::size_t end) {
+            (*static_cast<const Body*>(context))(begin, end);
+        }, &body);
+    }
+
+    unsigned getWorkerCount() const;
+    unsigned getThreadCount() const; // Workers + the calling thread
+
+private:
+    void runLoop(std::size_t count, std::size_t grain, RangeFunction body, const void* context);
+    static void drainLoop(void* system);
+    void schedule(Job* job);
+    void workerLoop(std::size_t index);
+    bool runOne(std::size_t index); // False if no work was found
+    Job* steal(std::size_t thief);
+    void finish(Job* job);
+};
+
+#endif // JOBSYSTEM_H
@@ -0,0 +1,667 @@
+/*
+ * Museum Escape - Level Loading Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "Level.h"
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <unordered_map>
+
+// ============================================================================
+// Cooked format layout
+// ============================================================================
+
+namespace {
+    const char COOKED_MAGIC[4] = { 'M', 'E', 'L', 'V' };
+    const std::uint32_t COOKED_VERSION = 2;
+
+    enum CookedTableIndex { TABLE_ROOMS, TABLE_DOORS, TABLE_ITEMS, TABLE_GUARDS,
+                            TABLE_PATROL_POINTS, TABLE_PUZZLES, TABLE_RULES, TABLE_WALLS, TABLE_COUNT };
+
+    struct CookedTable {
+        std::uint64_t offset; // From start of file
+        std::uint64_t count;
+    };
+
+    struct CookedHeader {
+        char magic[4];
+        std::uint32_t version;
+        std::uint32_t pointerSize; // Records embed pointers, so cooked files are per-ABI
+        std::uint32_t tableCount;
+        CookedTable tables[TABLE_COUNT];
+        std::uint64_t stringsOffset;
+        std::uint64_t stringsSize;
+        std::int32_t startRoomID;
+        float startX;
+        float startY;
+        std::uint32_t reserved;
+    };
+
+    std::size_t alignUp(std::size_t value, std::size_t alignment) {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    // Pattern answers are switch numbers: 1 Blue, 2 Red, 3 Green, 4 Yellow
+    bool isPatternAnswer(const char* answer) {
+        if (!answer || !*answer) return false;
+        for (const char* c = answer; *c; ++c) {
+            if (*c < '1' || *c > '4') return false;
+        }
+        return true;
+    }
+
+    // Text tokenizer: whitespace-separated words, "quoted strings", # comments
+    bool tokenize(const std::string& line, std::vector<std::string>& tokens, std::string& errorOut) {
+        tokens.clear();
+        std::size_t i = 0;
+        while (i < line.size()) {
+            char c = line[i];
+            if (c == ' ' || c == '\t' || c == '\r') { ++i; continue; }
+            if (c == '#') break;
+            if (c == '"') {
+                std::size_t close = line.find('"', i + 1);
+                if (close == std::string::npos) { errorOut = "unterminated string"; return false; }
+                tokens.push_back(line.substr(i + 1, close - i - 1));
+                i = close + 1;
+            } else {
+                std::size_t end = line.find_first_of(" \t\r#", i);
+                if (end == std::string::npos) end = line.size();
+                tokens.push_back(line.substr(i, end - i));
+                i = end;
+            }
+        }
+        return true;
+    }
+
+    bool toFloat(const std::string& token, float& value) {
+        char* end = nullptr;
+        value = std::strtof(token.c_str(), &end);
+        return !token.empty() && end == token.c_str() + token.size();
+    }
+
+    bool toInt(const std::string& token, std::int32_t& value) {
+        char* end = nullptr;
+        long parsed = std::strtol(token.c_str(), &end, 10);
+        value = static_cast<std::int32_t>(parsed);
+        return !token.empty() && end == token.c_str() + token.size();
+    }
+
+    // "*" means "any room" in rule rows
+    bool toRoomFilter(const std::string& token, std::int32_t& value) {
+        if (token == "*") { value = -1; return true; }
+        return toInt(token, value);
+    }
+
+    bool toTrigger(const std::string& token, RuleTrigger& trigger) {
+        if (token == "item_collected") trigger = RuleTrigger::ItemCollected;
+        else if (token == "puzzle_solved") trigger = RuleTrigger::PuzzleSolved;
+        else if (token == "timer_expired") trigger = RuleTrigger::TimerExpired;
+        else if (token == "room_entered") trigger = RuleTrigger::RoomEntered;
+        else if (token == "player_detected") trigger = RuleTrigger::PlayerDetected;
+        else return false;
+        return true;
+    }
+
+    bool toAction(const std::string& token, RuleAction& action) {
+        if (token == "spawn_key") action = RuleAction::SpawnKey;
+        else if (token == "victory") action = RuleAction::Victory;
+        else if (token == "defeat") action = RuleAction::Defeat;
+        else if (token == "warn") action = RuleAction::WarnPlayer;
+        else if (token == "notify") action = RuleAction::Notify;
+        else return false;
+        return true;
+    }
+
+    // CollisionMap tiles a room (1024 16-pixel tiles a side at most) and
+    // RoomTable indexes rooms by ID, so both are bounded
+    const float MAX_ROOM_SIZE = 16384.0f;
+    const std::int32_t MAX_ROOM_ID = 4095;
+
+    bool hasRoom(const LevelView& level, std::int32_t roomID) {
+        for (std::uint32_t i = 0; i < level.roomCount; ++i) {
+            if (level.rooms[i].id == roomID) return true;
+        }
+        return false;
+    }
+
+    bool sameText(const char* a, const char* b) {
+        return std::strcmp(a ? a : "", b ? b : "") == 0;
+    }
+
+    // Same count and every record equal; otherwise names the first difference
+    template<typename Record, typename Equal>
+    bool sameTable(const char* name, const Record* a, std::uint32_t aCount, const Record* b, std::uint32_t bCount,
+                   Equal equal, std::string& differenceOut) {
+        if (aCount != bCount) {
+            differenceOut = std::string(name) + " count " + std::to_string(aCount) + " vs " + std::to_string(bCount);
+            return false;
+        }
+        for (std::uint32_t i = 0; i < aCount; ++i) {
+            if (!equal(a[i], b[i])) {
+                differenceOut = std::string(name) + " " + std::to_string(i) + " differs";
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+// ============================================================================
+// Level
+// ============================================================================
+
+Level::Level() {}
+
+void Level::useStatic(const LevelView& level) {
+    clear();
+    view = level;
+}
+
+void Level::clear() {
+    strings.clear();
+    rooms.clear();
+    walls.clear();
+    doors.clear();
+    items.clear();
+    guards.clear();
+    patrolPoints.clear();
+    puzzles.clear();
+    rules.clear();
+    mappedFile.close();
+    view = LevelView();
+    error.clear();
+}
+
+const LevelView& Level::getView() const { return view; }
+const std::string& Level::getError() const { return error; }
+
+const char* Level::storeString(const std::string& text) {
+    strings.push_back(text);
+    return strings.back().c_str();
+}
+
+void Level::refreshView() {
+    view.rooms = rooms.data();
+    view.roomCount = static_cast<std::uint32_t>(rooms.size());
+    view.walls = walls.data();
+    view.wallCount = static_cast<std::uint32_t>(walls.size());
+    view.doors = doors.data();
+    view.doorCount = static_cast<std::uint32_t>(doors.size());
+    view.items = items.data();
+    view.itemCount = static_cast<std::uint32_t>(items.size());
+    view.guards = guards.data();
+    view.guardCount = static_cast<std::uint32_t>(guards.size());
+    view.patrolPoints = patrolPoints.data();
+    view.patrolPointCount = static_cast<std::uint32_t>(patrolPoints.size());
+    view.puzzles = puzzles.data();
+    view.puzzleCount = static_cast<std::uint32_t>(puzzles.size());
+    view.rules = rules.data();
+    view.ruleCount = static_cast<std::uint32_t>(rules.size());
+}
+
+bool Level::loadFromFile(const std::string& path) {
+    if (path.size() >= 5 && path.compare(path.size() - 5, 5, ".lvlc") == 0) {
+        return loadCooked(path);
+    }
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        clear();
+        error = "cannot open " + path;
+        return false;
+    }
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return loadFromText(contents.str(), path);
+}
+
+// ============================================================================
+// Text form
+// ============================================================================
+
+bool Level::loadFromText(const std::string& text, const std::string& sourceName) {
+    clear();
+
+    std::istringstream input(text);
+    std::string line;
+    std::vector<std::string> t;
+    int lineNumber = 0;
+    bool patrolAllowed = false; // patrol lines must follow their guard
+
+    auto fail = [&](const std::string& message) {
+        error = sourceName + ":" + std::to_string(lineNumber) + ": " + message;
+        return false;
+    };
+
+    while (std::getline(input, line)) {
+        ++lineNumber;
+        std::string tokenError;
+        if (!tokenize(line, t, tokenError)) return fail(tokenError);
+        if (t.empty()) continue;
+
+        const std::string& command = t[0];
+        bool isGuardLine = false;
+
+        if (command == "start") {
+            if (t.size() != 4 || !toInt(t[1], view.startRoomID) || !toFloat(t[2], view.startX) || !toFloat(t[3], view.startY))
+                return fail("expected: start <room> <x> <y>");
+        }
+        else if (command == "room") {
+            RoomDef room{};
+            if (t.size() < 7 || t.size() > 9 || !toInt(t[1], room.id) ||
+                !toFloat(t[3], room.x) || !toFloat(t[4], room.y) ||
+                !toFloat(t[5], room.width) || !toFloat(t[6], room.height))
+                return fail("expected: room <id> \"name\" <x> <y> <w> <h> [\"texture\" [\"solvedTexture\"]]");
+            room.name = storeString(t[2]);
+            room.texture = storeString(t.size() > 7 ? t[7] : "");
+            room.solvedTexture = storeString(t.size() > 8 ? t[8] : "");
+            room.isExit = 0;
+            rooms.push_back(room);
+        }
+        else if (command == "wall") {
+            WallDef wall{};
+            if (t.size() != 6 || !toInt(t[1], wall.roomID) || !toFloat(t[2], wall.x) || !toFloat(t[3], wall.y) ||
+                !toFloat(t[4], wall.width) || !toFloat(t[5], wall.height))
+                return fail("expected: wall <room> <x> <y> <w> <h>");
+            walls.push_back(wall);
+        }
+        else if (command == "exit") {
+            std::int32_t id = 0;
+            if (t.size() != 2 || !toInt(t[1], id)) return fail("expected: exit <room>");
+            bool found = false;
+            for (auto& room : rooms) {
+                if (room.id == id) { room.isExit = 1; found = true; }
+            }
+            if (!found) return fail("exit names unknown room " + t[1]);
+        }
+        else if (command == "door") {
+            DoorDef door{};
+            if ((t.size() != 5 && t.size() != 6) || !toInt(t[1], door.roomID) ||
+                !toFloat(t[2], door.x) || !toFloat(t[3], door.y) || !toInt(t[4], door.targetRoomID))
+                return fail("expected: door <room> <x> <y> <targetRoom> [\"requiredKey\"]");
+            door.requiredKey = storeString(t.size() == 6 ? t[5] : "");
+            doors.push_back(door);
+        }
+        else if (command == "item") {
+            ItemDef item{};
+            if (t.size() < 3 || !toInt(t[1], item.roomID)) return fail("expected: item <room> <type> ...");
+            std::size_t expected = 7;
+            if (t[2] == "basic") item.type = ItemDefType::Basic;
+            else if (t[2] == "key") item.type = ItemDefType::Key;
+            else if (t[2] == "passcode") item.type = ItemDefType::Passcode;
+            else if (t[2] == "tool") { item.type = ItemDefType::Tool; expected = 8; }
+            else return fail("unknown item type '" + t[2] + "'");
+
+            if (t.size() != expected || !toFloat(t[expected - 2], item.x) || !toFloat(t[expected - 1], item.y))
+                return fail(expected == 8 ? "expected: item <room> tool \"name\" \"toolType\" \"description\" <x> <y>"
+                                          : "expected: item <room> <type> \"name\" \"detail\" <x> <y>");
+            item.name = storeString(t[3]);
+            item.detail = storeString(t[4]);
+            item.extra = storeString(expected == 8 ? t[5] : "");
+            items.push_back(item);
+        }
+        else if (command == "guard") {
+            GuardDef guard{};
+            if (t.size() != 5 || !toInt(t[1], guard.roomID) || !toFloat(t[2], guard.x) ||
+                !toFloat(t[3], guard.y) || !toFloat(t[4], guard.detectionRange))
+                return fail("expected: guard <room> <x> <y> <detectionRange>");
+            guard.firstPatrolPoint = static_cast<std::uint32_t>(patrolPoints.size());
+            guard.patrolPointCount = 0;
+            guards.push_back(guard);
+            isGuardLine = true;
+        }
+        else if (command == "patrol") {
+            PatrolPointDef point{};
+            if (t.size() != 3 || !toFloat(t[1], point.x) || !toFloat(t[2], point.y))
+                return fail("expected: patrol <x> <y>");
+            if (!patrolAllowed) return fail("patrol must follow a guard line");
+            patrolPoints.push_back(point);
+            guards.back().patrolPointCount++;
+            isGuardLine = true;
+        }
+        else if (command == "puzzle") {
+            PuzzleDef puzzle{};
+            if (t.size() < 4 || !toInt(t[1], puzzle.roomID)) return fail("expected: puzzle <room> <type> ...");
+            const std::string& type = t[2];
+            if (type == "riddle" || type == "math") {
+                if (t.size() != 5) return fail("expected: puzzle <room> " + type + " \"text\" \"answer\"");
+                puzzle.type = type == "riddle" ? PuzzleType::Riddle : PuzzleType::Math;
+                puzzle.text = storeString(t[3]);
+                puzzle.answer = storeString(t[4]);
+            } else if (type == "pattern" || type == "lock" || type == "wire") {
+                if (t.size() != 4) return fail("expected: puzzle <room> " + type + " \"answer\"");
+                puzzle.type = type == "pattern" ? PuzzleType::Pattern
+                            : type == "lock" ? PuzzleType::Lock : PuzzleType::Wire;
+                if (type == "pattern" && !isPatternAnswer(t[3].c_str())) {
+                    return fail("pattern answer must be switch numbers 1-4, e.g. \"1324\"");
+                }
+                puzzle.text = storeString("");
+                puzzle.answer = storeString(t[3]);
+            } else {
+                return fail("unknown puzzle type '" + type + "'");
+            }
+            puzzles.push_back(puzzle);
+        }
+        else if (command == "rule") {
+            // rule <trigger> <room|*> <"item"|*> <action> [args...]
+            GameRule rule{};
+            if (t.size() < 5 || !toTrigger(t[1], rule.trigger) || !toRoomFilter(t[2], rule.roomID) ||
+                !toAction(t[4], rule.action))
+                return fail("expected: rule <trigger> <room|*> <\"item\"|*> <action> [args]");
+            rule.itemID = t[3] == "*" ? INVALID_ITEM_ID : internItemID(t[3]);
+            rule.text = storeString("");
+            rule.keyID = rule.text;
+
+            if (rule.action == RuleAction::SpawnKey) {
+                if (t.size() != 9 || !toFloat(t[7], rule.x) || !toFloat(t[8], rule.y))
+                    return fail("expected: ... spawn_key \"name\" \"keyID\" <x> <y>");
+                rule.text = storeString(t[5]);
+                rule.keyID = storeString(t[6]);
+            } else if (rule.action == RuleAction::WarnPlayer || rule.action == RuleAction::Notify) {
+                if (t.size() != 6) return fail("expected: ... " + t[4] + " \"text\"");
+                rule.text = storeString(t[5]);
+            } else if (t.size() != 5) {
+                return fail("unexpected arguments after " + t[4]);
+            }
+            rules.push_back(rule);
+        }
+        else {
+            return fail("unknown command '" + command + "'");
+        }
+
+        patrolAllowed = isGuardLine;
+    }
+
+    refreshView();
+    std::string validationError;
+    if (!validate(view, validationError)) {
+        error = sourceName + ": " + validationError;
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// Validation
+// ============================================================================
+
+bool Level::validate(const LevelView& level, std::string& errorOut) {
+    if (level.roomCount == 0) { errorOut = "level has no rooms"; return false; }
+
+    for (std::uint32_t i = 0; i < level.roomCount; ++i) {
+        const RoomDef& room = level.rooms[i];
+        if (room.id < 0) { errorOut = "negative room id"; return false; }
+        if (room.id > MAX_ROOM_ID || !(room.width > 0.0f && room.width <= MAX_ROOM_SIZE) ||
+            !(room.height > 0.0f && room.height <= MAX_ROOM_SIZE)) {
+            errorOut = "room " + std::to_string(room.id) + " is invalid";
+            return false;
+        }
+        for (std::uint32_t j = i + 1; j < level.roomCount; ++j) {
+            if (level.rooms[i].id == level.rooms[j].id) {
+                errorOut = "duplicate room " + std::to_string(level.rooms[i].id);
+                return false;
+            }
+        }
+    }
+    if (!hasRoom(level, level.startRoomID)) { errorOut = "start room does not exist"; return false; }
+
+    for (std::uint32_t i = 0; i < level.wallCount; ++i) {
+        const WallDef& wall = level.walls[i];
+        if (!hasRoom(level, wall.roomID) || !(wall.width > 0.0f) || !(wall.height > 0.0f)) {
+            errorOut = "wall " + std::to_string(i) + " is invalid";
+            return false;
+        }
+    }
+    for (std::uint32_t i = 0; i < level.doorCount; ++i) {
+        const DoorDef& door = level.doors[i];
+        if (!hasRoom(level, door.roomID) || !hasRoom(level, door.targetRoomID)) {
+            errorOut = "door " + std::to_string(i) + " links unknown room";
+            return false;
+        }
+    }
+    for (std::uint32_t i = 0; i < level.itemCount; ++i) {
+        if (!hasRoom(level, level.items[i].roomID) || level.items[i].type > ItemDefType::Tool) {
+            errorOut = "item " + std::to_string(i) + " is invalid";
+            return false;
+        }
+    }
+    for (std::uint32_t i = 0; i < level.guardCount; ++i) {
+        const GuardDef& guard = level.guards[i];
+        if (!hasRoom(level, guard.roomID) ||
+            guard.firstPatrolPoint > level.patrolPointCount ||
+            guard.patrolPointCount > level.patrolPointCount - guard.firstPatrolPoint) {
+            errorOut = "guard " + std::to_string(i) + " is invalid";
+            return false;
+        }
+    }
+    for (std::uint32_t i = 0; i < level.puzzleCount; ++i) {
+        const PuzzleDef& puzzle = level.puzzles[i];
+        if (!hasRoom(level, puzzle.roomID) || puzzle.type > PuzzleType::Wire ||
+            (puzzle.type == PuzzleType::Pattern && !isPatternAnswer(puzzle.answer))) {
+            errorOut = "puzzle " + std::to_string(i) + " is invalid";
+            return false;
+        }
+    }
+    for (std::uint32_t i = 0; i < level.ruleCount; ++i) {
+        const GameRule& rule = level.rules[i];
+        if (rule.trigger >= RuleTrigger::Count || rule.action > RuleAction::Notify ||
+            (rule.roomID != -1 && !hasRoom(level, rule.roomID))) {
+            errorOut = "rule " + std::to_string(i) + " is invalid";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Level::sameContent(const LevelView& a, const LevelView& b, std::string& differenceOut) {
+    if (a.startRoomID != b.startRoomID || a.startX != b.startX || a.startY != b.startY) {
+        differenceOut = "start differs";
+        return false;
+    }
+    return sameTable("room", a.rooms, a.roomCount, b.rooms, b.roomCount, [](const RoomDef& x, const RoomDef& y) {
+               return x.id == y.id && sameText(x.name, y.name) && x.x == y.x && x.y == y.y && x.width == y.width &&
+                      x.height == y.height && sameText(x.texture, y.texture) &&
+                      sameText(x.solvedTexture, y.solvedTexture) && x.isExit == y.isExit;
+           }, differenceOut) &&
+           sameTable("wall", a.walls, a.wallCount, b.walls, b.wallCount, [](const WallDef& x, const WallDef& y) {
+               return x.roomID == y.roomID && x.x == y.x && x.y == y.y && x.width == y.width && x.height == y.height;
+           }, differenceOut) &&
+           sameTable("door", a.doors, a.doorCount, b.doors, b.doorCount, [](const DoorDef& x, const DoorDef& y) {
+               return x.roomID == y.roomID && x.x == y.x && x.y == y.y && x.targetRoomID == y.targetRoomID &&
+                      sameText(x.requiredKey, y.requiredKey);
+           }, differenceOut) &&
+           sameTable("item", a.items, a.itemCount, b.items, b.itemCount, [](const ItemDef& x, const ItemDef& y) {
+               return x.roomID == y.roomID && x.type == y.type && sameText(x.name, y.name) &&
+                      sameText(x.detail, y.detail) && sameText(x.extra, y.extra) && x.x == y.x && x.y == y.y;
+           }, differenceOut) &&
+           sameTable("guard", a.guards, a.guardCount, b.guards, b.guardCount, [](const GuardDef& x, const GuardDef& y) {
+               return x.roomID == y.roomID && x.x == y.x && x.y == y.y && x.detectionRange == y.detectionRange &&
+                      x.firstPatrolPoint == y.firstPatrolPoint && x.patrolPointCount == y.patrolPointCount;
+           }, differenceOut) &&
+           sameTable("patrol point", a.patrolPoints, a.patrolPointCount, b.patrolPoints, b.patrolPointCount,
+                     [](const PatrolPointDef& x, const PatrolPointDef& y) { return x.x == y.x && x.y == y.y; },
+                     differenceOut) &&
+           sameTable("puzzle", a.puzzles, a.puzzleCount, b.puzzles, b.puzzleCount, [](const PuzzleDef& x, const PuzzleDef& y) {
+               return x.roomID == y.roomID && x.type == y.type && sameText(x.text, y.text) && sameText(x.answer, y.answer);
+           }, differenceOut) &&
+           sameTable("rule", a.rules, a.ruleCount, b.rules, b.ruleCount, [](const GameRule& x, const GameRule& y) {
+               return x.trigger == y.trigger && x.roomID == y.roomID && x.itemID == y.itemID && x.action == y.action &&
+                      sameText(x.text, y.text) && sameText(x.keyID, y.keyID) && x.x == y.x && x.y == y.y;
+           }, differenceOut);
+}
+
+// ============================================================================
+// Cooked form
+// ============================================================================
+
+bool Level::saveCooked(const LevelView& level, const std::string& path, std::string* errorOut) {
+    // Deduplicated string pool; records store pool offsets in their pointer fields
+    std::string pool;
+    std::unordered_map<std::string, std::uint64_t> poolOffsets;
+    auto intern = [&](const char* text) {
+        if (!text) text = "";
+        auto found = poolOffsets.find(text);
+        if (found != poolOffsets.end()) return reinterpret_cast<const char*>(static_cast<std::uintptr_t>(found->second));
+        std::uint64_t offset = pool.size();
+        pool.append(text);
+        pool.push_back('\0');
+        poolOffsets.emplace(text, offset);
+        return reinterpret_cast<const char*>(static_cast<std::uintptr_t>(offset));
+    };
+
+    std::vector<RoomDef> outRooms(level.rooms, level.rooms + level.roomCount);
+    for (auto& r : outRooms) { r.name = intern(r.name); r.texture = intern(r.texture); r.solvedTexture = intern(r.solvedTexture); }
+    std::vector<DoorDef> outDoors(level.doors, level.doors + level.doorCount);
+    for (auto& d : outDoors) d.requiredKey = intern(d.requiredKey);
+    std::vector<ItemDef> outItems(level.items, level.items + level.itemCount);
+    for (auto& it : outItems) { it.name = intern(it.name); it.detail = intern(it.detail); it.extra = intern(it.extra); }
+    std::vector<PuzzleDef> outPuzzles(level.puzzles, level.puzzles + level.puzzleCount);
+    for (auto& p : outPuzzles) { p.text = intern(p.text); p.answer = intern(p.answer); }
+    std::vector<GameRule> outRules(level.rules, level.rules + level.ruleCount);
+    for (auto& r : outRules) { r.text = intern(r.text); r.keyID = intern(r.keyID); }
+
+    CookedHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, COOKED_MAGIC, sizeof(COOKED_MAGIC));
+    header.version = COOKED_VERSION;
+    header.pointerSize = sizeof(void*);
+    header.tableCount = TABLE_COUNT;
+    header.startRoomID = level.startRoomID;
+    header.startX = level.startX;
+    header.startY = level.startY;
+
+    struct Block { const void* data; std::size_t bytes; std::size_t count; };
+    Block blocks[TABLE_COUNT] = {
+        { outRooms.data(), outRooms.size() * sizeof(RoomDef), outRooms.size() },
+        { outDoors.data(), outDoors.size() * sizeof(DoorDef), outDoors.size() },
+        { outItems.data(), outItems.size() * sizeof(ItemDef), outItems.size() },
+        { level.guards, level.guardCount * sizeof(GuardDef), level.guardCount },
+        { level.patrolPoints, level.patrolPointCount * sizeof(PatrolPointDef), level.patrolPointCount },
+        { outPuzzles.data(), outPuzzles.size() * sizeof(PuzzleDef), outPuzzles.size() },
+        { outRules.data(), outRules.size() * sizeof(GameRule), outRules.size() },
+        { level.walls, level.wallCount * sizeof(WallDef), level.wallCount },
+    };
+
+    std::size_t cursor = sizeof(CookedHeader);
+    for (int i = 0; i < TABLE_COUNT; ++i) {
+        cursor = alignUp(cursor, alignof(std::max_align_t));
+        header.tables[i].offset = cursor;
+        header.tables[i].count = blocks[i].count;
+        cursor += blocks[i].bytes;
+    }
+    header.stringsOffset = cursor;
+    header.stringsSize = pool.size();
+
+    std::vector<char> image(cursor + pool.size(), 0);
+    std::memcpy(image.data(), &header, sizeof(header));
+    for (int i = 0; i < TABLE_COUNT; ++i) {
+        if (blocks[i].bytes) std::memcpy(image.data() + header.tables[i].offset, blocks[i].data, blocks[i].bytes);
+    }
+    if (!pool.empty()) std::memcpy(image.data() + header.stringsOffset, pool.data(), pool.size());
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file || !file.write(image.data(), static_cast<std::streamsize>(image.size()))) {
+        if (errorOut) *errorOut = "cannot write " + path;
+        return false;
+    }
+    return true;
+}
+
+bool Level::loadCooked(const std::string& path) {
+    clear();
+    if (!mappedFile.open(path)) {
+        error = "cannot map " + path;
+        return false;
+    }
+
+    unsigned char* base = mappedFile.getData();
+    std::size_t fileSize = mappedFile.getSize();
+    auto fail = [&](const std::string& message) {
+        error = path + ": " + message;
+        mappedFile.close();
+        view = LevelView();
+        return false;
+    };
+
+    if (fileSize < sizeof(CookedHeader)) return fail("truncated header");
+    const CookedHeader& header = *reinterpret_cast<const CookedHeader*>(base);
+    if (std::memcmp(header.magic, COOKED_MAGIC, sizeof(COOKED_MAGIC)) != 0) return fail("not a cooked level");
+    if (header.version != COOKED_VERSION || header.tableCount != TABLE_COUNT) return fail("unsupported version");
+    if (header.pointerSize != sizeof(void*)) return fail("cooked for a different pointer size");
+
+    if (header.stringsOffset > fileSize || header.stringsSize > fileSize - header.stringsOffset ||
+        header.stringsSize == 0 || base[header.stringsOffset + header.stringsSize - 1] != '\0')
+        return fail("bad string pool");
+
+    const std::size_t recordSizes[TABLE_COUNT] = { sizeof(RoomDef), sizeof(DoorDef), sizeof(ItemDef), sizeof(GuardDef),
+                                                   sizeof(PatrolPointDef), sizeof(PuzzleDef), sizeof(GameRule),
+                                                   sizeof(WallDef) };
+    for (int i = 0; i < TABLE_COUNT; ++i) {
+        const CookedTable& table = header.tables[i];
+        if (table.offset % alignof(std::max_align_t) != 0 || table.offset > fileSize ||
+            table.count > (fileSize - table.offset) / recordSizes[i])
+            return fail("bad table " + std::to_string(i));
+    }
+
+    // Pointer fix-up: pool offset -> address inside the mapping
+    const char* pool = reinterpret_cast<const char*>(base + header.stringsOffset);
+    bool poolOk = true;
+    auto fix = [&](const char*& field) {
+        std::uintptr_t offset = reinterpret_cast<std::uintptr_t>(field);
+        if (offset >= header.stringsSize) { poolOk = false; offset = header.stringsSize - 1; }
+        field = pool + offset;
+    };
+    auto table = [&](int index) { return base + header.tables[index].offset; };
+
+    RoomDef* cookedRooms = reinterpret_cast<RoomDef*>(table(TABLE_ROOMS));
+    DoorDef* cookedDoors = reinterpret_cast<DoorDef*>(table(TABLE_DOORS));
+    ItemDef* cookedItems = reinterpret_cast<ItemDef*>(table(TABLE_ITEMS));
+    PuzzleDef* cookedPuzzles = reinterpret_cast<PuzzleDef*>(table(TABLE_PUZZLES));
+    GameRule* cookedRules = reinterpret_cast<GameRule*>(table(TABLE_RULES));
+
+    for (std::uint64_t i = 0; i < header.tables[TABLE_ROOMS].count; ++i) {
+        fix(cookedRooms[i].name); fix(cookedRooms[i].texture); fix(cookedRooms[i].solvedTexture);
+    }
+    for (std::uint64_t i = 0; i < header.tables[TABLE_DOORS].count; ++i) fix(cookedDoors[i].requiredKey);
+    for (std::uint64_t i = 0; i < header.tables[TABLE_ITEMS].count; ++i) {
+        fix(cookedItems[i].name); fix(cookedItems[i].detail); fix(cookedItems[i].extra);
+    }
+    for (std::uint64_t i = 0; i < header.tables[TABLE_PUZZLES].count; ++i) {
+        fix(cookedPuzzles[i].text); fix(cookedPuzzles[i].answer);
+    }
+    for (std::uint64_t i = 0; i < header.tables[TABLE_RULES].count; ++i) {
+        fix(cookedRules[i].text); fix(cookedRules[i].keyID);
+    }
+    if (!poolOk) return fail("string offset out of range");
+
+    view.rooms = cookedRooms;
+    view.roomCount = static_cast<std::uint32_t>(header.tables[TABLE_ROOMS].count);
+    view.walls = reinterpret_cast<const WallDef*>(table(TABLE_WALLS));
+    view.wallCount = static_cast<std::uint32_t>(header.tables[TABLE_WALLS].count);
+    view.doors = cookedDoors;
+    view.doorCount = static_cast<std::uint32_t>(header.tables[TABLE_DOORS].count);
+    view.items = cookedItems;
+    view.itemCount = static_cast<std::uint32_t>(header.tables[TABLE_ITEMS].count);
+    view.guards = reinterpret_cast<const GuardDef*>(table(TABLE_GUARDS));
+    view.guardCount = static_cast<std::uint32_t>(header.tables[TABLE_GUARDS].count);
+    view.patrolPoints = reinterpret_cast<const PatrolPointDef*>(table(TABLE_PATROL_POINTS));
+    view.patrolPointCount = static_cast<std::uint32_t>(header.tables[TABLE_PATROL_POINTS].count);
+    view.puzzles = cookedPuzzles;
+    view.puzzleCount = static_cast<std::uint32_t>(header.tables[TABLE_PUZZLES].count);
+    view.rules = cookedRules;
+    view.ruleCount = static_cast<std::uint32_t>(header.tables[TABLE_RULES].count);
+    view.startRoomID = header.startRoomID;
+    view.startX = header.startX;
+    view.startY = header.startY;
+
+    // Rule item IDs are hashes; register the names so they read back in debug output
+    for (std::uint32_t i = 0; i < view.itemCount; ++i) internItemID(view.items[i].name);
+
+    std::string validationError;
+    if (!validate(view, validationError)) return fail(validationError);
+    return true;
+}
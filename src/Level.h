@@ -0,0 +1,63 @@
+#ifndef LEVEL_H
+#define LEVEL_H
+
+#include <deque>
+#include <string>
+#include <vector>
+#include "LevelData.h"
+#include "MappedFile.h"
+
+// Level - loads level records from either form of the level format:
+//  - text (.lvl): line-based, for authoring (see assets/museum.lvl)
+//  - cooked (.lvlc): the records as laid out in memory plus a string pool.
+//    Loading is one copy-on-write mmap and an offset -> pointer fix-up pass.
+// Either way the result is exposed as a LevelView. Levels compiled into the
+// game (DefaultLevel.h) are adopted as-is with useStatic().
+class Level {
+private:
+    // Storage for text-loaded levels
+    std::deque<std::string> strings; // deque keeps c_str() pointers stable
+    std::vector<RoomDef> rooms;
+    std::vector<WallDef> walls;
+    std::vector<DoorDef> doors;
+    std::vector<ItemDef> items;
+    std::vector<GuardDef> guards;
+    std::vector<PatrolPointDef> patrolPoints;
+    std::vector<PuzzleDef> puzzles;
+    std::vector<GameRule> rules;
+
+    // Storage for cooked levels
+    MappedFile mappedFile;
+
+    LevelView view;
+    std::string error;
+
+public:
+    Level();
+
+    // Picks the loader from the extension (.lvlc = cooked, anything else = text)
+    bool loadFromFile(const std::string& path);
+    bool loadFromText(const std::string& text, const std::string& sourceName = "<memory>");
+    bool loadCooked(const std::string& path);
+    // Adopt records that outlive the Level (e.g. constexpr tables) - no copy
+    void useStatic(const LevelView& level);
+
+    // Write any level (file-loaded or compiled-in) in cooked form
+    static bool saveCooked(const LevelView& level, const std::string& path, std::string* errorOut = nullptr);
+
+    // Structural checks shared by every loader (IDs exist, enums/ranges valid)
+    static bool validate(const LevelView& level, std::string& errorOut);
+
+    // Record-for-record equality; names the first difference (e.g. "door 3 differs")
+    static bool sameContent(const LevelView& a, const LevelView& b, std::string& differenceOut);
+
+    const LevelView& getView() const;
+    const std::string& getError() const;
+    void clear();
+
+private:
+    const char* storeString(const std::string& text);
+    void refreshView();
+};
+
+#endif // LEVEL_H
@@ -0,0 +1,52 @@
+/*
+ * Museum Escape - Level Arena Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "LevelArena.h"
+#include <algorithm>
+
+LevelArena::LevelArena(std::size_t defaultBlockSize)
+    : currentBlock(0), blockSize(defaultBlockSize), bytesUsed(0) {}
+
+LevelArena::~LevelArena() {
+    reset();
+}
+
+void LevelArena::reset() {
+    for (auto it = destructors.rbegin(); it != destructors.rend(); ++it) {
+        it->destroy(it->object);
+    }
+    destructors.clear();
+
+    for (auto& block : blocks) block.used = 0;
+    currentBlock = 0;
+    bytesUsed = 0;
+}
+
+std::size_t LevelArena::getBytesUsed() const { return bytesUsed; }
+std::size_t LevelArena::getBlockCount() const { return blocks.size(); }
+
+void* LevelArena::allocate(std::size_t size, std::size_t alignment) {
+    // Try the current block, then any later (already rewound) block
+    while (currentBlock < blocks.size()) {
+        Block& block = blocks[currentBlock];
+        std::size_t offset = (block.used + alignment - 1) & ~(alignment - 1);
+        if (offset + size <= block.size) {
+            block.used = offset + size;
+            bytesUsed += size;
+            return block.memory.get() + offset;
+        }
+        ++currentBlock;
+    }
+
+    // Out of space - add a block (oversized objects get a block of their own)
+    Block block;
+    block.size = std::max(blockSize, size);
+    block.memory = std::make_unique<std::byte[]>(block.size);
+    block.used = size;
+    blocks.push_back(std::move(block));
+    currentBlock = blocks.size() - 1;
+    bytesUsed += size;
+    return blocks.back().memory.get();
+}
@@ -0,0 +1,64 @@
+#ifndef LEVELARENA_H
+#define LEVELARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// LevelArena - bump allocator that owns every entity of the loaded level
+// (rooms, items, guards, doors). Objects created together sit next
+// to each other in memory, rooms keep plain pointers (no refcounting), and
+// reset() tears the whole level down in one pass while keeping the blocks
+// around for the next load.
+class LevelArena {
+private:
+    struct Block {
+        std::unique_ptr<std::byte[]> memory;
+        std::size_t size;
+        std::size_t used;
+    };
+
+    struct Destructor {
+        void (*destroy)(void*);
+        void* object;
+    };
+
+    std::vector<Block> blocks;
+    std::size_t currentBlock;
+    std::size_t blockSize;
+    std::vector<Destructor> destructors;
+    std::size_t bytesUsed;
+
+public:
+    explicit LevelArena(std::size_t defaultBlockSize = 64 * 1024);
+    ~LevelArena();
+
+    LevelArena(const LevelArena&) = delete;
+    LevelArena& operator=(const LevelArena&) = delete;
+
+    // Construct a T inside the arena. The pointer stays valid until reset().
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "LevelArena: over-aligned type");
+        void* memory = allocate(sizeof(T), alignof(T));
+        T* object = new (memory) T(std::forward<Args>(args)...);
+        if constexpr (!std::is_trivially_destructible_v<T>) {
+            destructors.push_back({ [](void* p) { static_cast<T*>(p)->~T(); }, object });
+        }
+        return object;
+    }
+
+    // Destroy every object (newest first) and rewind all blocks
+    void reset();
+
+    std::size_t getBytesUsed() const;
+    std::size_t getBlockCount() const;
+
+private:
+    void* allocate(std::size_t size, std::size_t alignment);
+};
+
+#endif // LEVELARENA_H
@@ -0,0 +1,140 @@
+#ifndef LEVELCHECKS_H
+#define LEVELCHECKS_H
+
+#include <cstdint>
+#include "LevelData.h"
+
+// constexpr checks for levels compiled into the game. Use them in static_asserts
+// so a broken built-in level fails the build instead of the first playthrough.
+
+constexpr std::uint32_t LEVEL_CHECK_MAX_ROOMS = 64;
+constexpr std::uint32_t LEVEL_CHECK_MAX_KEYS = 64;
+
+constexpr bool levelTextEqual(const char* a, const char* b) {
+    while (*a && *a == *b) { ++a; ++b; }
+    return *a == *b;
+}
+
+constexpr int levelRoomIndex(const LevelView& level, std::int32_t roomID) {
+    for (std::uint32_t i = 0; i < level.roomCount; ++i) {
+        if (level.rooms[i].id == roomID) return static_cast<int>(i);
+    }
+    return -1;
+}
+
+constexpr bool levelPointInRoom(const RoomDef& room, float x, float y) {
+    return x >= room.x && x <= room.x + room.width && y >= room.y && y <= room.y + room.height;
+}
+
+// Every wall, door, item, guard and puzzle refers to an existing room, and the start room exists
+constexpr bool levelRoomReferencesValid(const LevelView& level) {
+    if (level.roomCount == 0 || level.roomCount > LEVEL_CHECK_MAX_ROOMS) return false;
+    if (levelRoomIndex(level, level.startRoomID) < 0) return false;
+    for (std::uint32_t i = 0; i < level.wallCount; ++i) {
+        if (levelRoomIndex(level, level.walls[i].roomID) < 0) return false;
+    }
+    for (std::uint32_t i = 0; i < level.doorCount; ++i) {
+        if (levelRoomIndex(level, level.doors[i].roomID) < 0) return false;
+        if (levelRoomIndex(level, level.doors[i].targetRoomID) < 0) return false;
+    }
+    for (std::uint32_t i = 0; i < level.itemCount; ++i) {
+        if (levelRoomIndex(level, level.items[i].roomID) < 0) return false;
+    }
+    for (std::uint32_t i = 0; i < level.guardCount; ++i) {
+        if (levelRoomIndex(level, level.guards[i].roomID) < 0) return false;
+    }
+    for (std::uint32_t i = 0; i < level.puzzleCount; ++i) {
+        if (levelRoomIndex(level, level.puzzles[i].roomID) < 0) return false;
+    }
+    return true;
+}
+
+// Guards start and patrol inside their room, and patrol ranges stay in the table
+constexpr bool levelPatrolsInBounds(const LevelView& level) {
+    for (std::uint32_t i = 0; i < level.guardCount; ++i) {
+        const GuardDef& guard = level.guards[i];
+        int room = levelRoomIndex(level, guard.roomID);
+        if (room < 0) return false;
+        if (!levelPointInRoom(level.rooms[room], guard.x, guard.y)) return false;
+        if (guard.firstPatrolPoint + guard.patrolPointCount > level.patrolPointCount) return false;
+        for (std::uint32_t p = 0; p < guard.patrolPointCount; ++p) {
+            const PatrolPointDef& point = level.patrolPoints[guard.firstPatrolPoint + p];
+            if (!levelPointInRoom(level.rooms[room], point.x, point.y)) return false;
+        }
+    }
+    return true;
+}
+
+// Every locked door's key can be picked up (or earned from a puzzle) in a room
+// the player can reach from the start without that door - flood fill over the
+// door graph, opening doors as their keys become available.
+constexpr bool levelKeysObtainable(const LevelView& level) {
+    if (level.roomCount > LEVEL_CHECK_MAX_ROOMS) return false;
+
+    bool reachable[LEVEL_CHECK_MAX_ROOMS] = {};
+    const char* keys[LEVEL_CHECK_MAX_KEYS] = {};
+    std::uint32_t keyCount = 0;
+
+    int start = levelRoomIndex(level, level.startRoomID);
+    if (start < 0) return false;
+    reachable[start] = true;
+
+    auto holdsKey = [&](const char* key) {
+        for (std::uint32_t k = 0; k < keyCount; ++k) {
+            if (levelTextEqual(keys[k], key)) return true;
+        }
+        return false;
+    };
+    auto addKey = [&](const char* key) {
+        if (!holdsKey(key) && keyCount < LEVEL_CHECK_MAX_KEYS) keys[keyCount++] = key;
+    };
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+
+        // Collect keys lying in (or rewarded by puzzles in) reachable rooms
+        for (std::uint32_t i = 0; i < level.itemCount; ++i) {
+            int room = levelRoomIndex(level, level.items[i].roomID);
+            if (room >= 0 && reachable[room] && level.items[i].type == ItemDefType::Key) addKey(level.items[i].detail);
+        }
+        for (std::uint32_t i = 0; i < level.ruleCount; ++i) {
+            const GameRule& rule = level.rules[i];
+            if (rule.action != RuleAction::SpawnKey || rule.trigger != RuleTrigger::PuzzleSolved) continue;
+            int room = levelRoomIndex(level, rule.roomID);
+            bool hasPuzzle = false;
+            for (std::uint32_t p = 0; p < level.puzzleCount; ++p) {
+                if (level.puzzles[p].roomID == rule.roomID) hasPuzzle = true;
+            }
+            if (room >= 0 && reachable[room] && hasPuzzle) addKey(rule.keyID);
+        }
+
+        // Walk every door we can open
+        for (std::uint32_t i = 0; i < level.doorCount; ++i) {
+            const DoorDef& door = level.doors[i];
+            int from = levelRoomIndex(level, door.roomID);
+            int to = levelRoomIndex(level, door.targetRoomID);
+            if (from < 0 || to < 0 || !reachable[from] || reachable[to]) continue;
+            if (door.requiredKey[0] == '\0' || holdsKey(door.requiredKey)) {
+                reachable[to] = true;
+                changed = true;
+            }
+        }
+    }
+
+    for (std::uint32_t i = 0; i < level.doorCount; ++i) {
+        const char* key = level.doors[i].requiredKey;
+        if (key[0] != '\0' && !holdsKey(key)) return false;
+    }
+    return true;
+}
+
+// At least one room is marked as the exit
+constexpr bool levelHasExit(const LevelView& level) {
+    for (std::uint32_t i = 0; i < level.roomCount; ++i) {
+        if (level.rooms[i].isExit) return true;
+    }
+    return false;
+}
+
+#endif // LEVELCHECKS_H
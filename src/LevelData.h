@@ -0,0 +1,94 @@
+#ifndef LEVELDATA_H
+#define LEVELDATA_H
+
+#include <cstdint>
+#include "GameRules.h"
+
+// Plain level records shared by the text loader, the cooked (binary) loader and
+// any level tables compiled into the game. Strings are NUL-terminated and owned
+// by whoever owns the records (a Level, a mapped file, or static storage).
+
+enum class ItemDefType : std::uint8_t { Basic, Key, Passcode, Tool };
+
+enum class PuzzleType : std::uint8_t { Riddle, Pattern, Lock, Math, Wire };
+
+struct RoomDef {
+    std::int32_t id;
+    const char* name;
+    float x, y, width, height;
+    const char* texture;       // "" = untextured
+    const char* solvedTexture; // "" = no reveal image
+    std::uint32_t isExit;
+};
+
+// Solid rectangle inside a room (wall, display case, ...). Rasterized into the
+// room's collision tiles, so its edges snap outward to the tile grid.
+struct WallDef {
+    std::int32_t roomID;
+    float x, y, width, height;
+};
+
+struct DoorDef {
+    std::int32_t roomID;
+    float x, y;
+    std::int32_t targetRoomID;
+    const char* requiredKey; // "" = unlocked
+};
+
+// detail/extra by type - Basic: description | Key: door key ID |
+// Passcode: code | Tool: tool type, extra = description
+struct ItemDef {
+    std::int32_t roomID;
+    ItemDefType type;
+    const char* name;
+    const char* detail;
+    const char* extra;
+    float x, y;
+};
+
+struct PatrolPointDef {
+    float x, y;
+};
+
+struct GuardDef {
+    std::int32_t roomID;
+    float x, y;
+    float detectionRange;
+    std::uint32_t firstPatrolPoint; // Index into LevelView::patrolPoints
+    std::uint32_t patrolPointCount;
+};
+
+// text/answer by type - Riddle: riddle, answer | Pattern: "" , digits ("1324") |
+// Lock: "", code | Math: equation, answer | Wire: "", comma-separated colours
+struct PuzzleDef {
+    std::int32_t roomID;
+    PuzzleType type;
+    const char* text;
+    const char* answer;
+};
+
+// A complete level - just pointers and counts, no ownership
+struct LevelView {
+    const RoomDef* rooms = nullptr;
+    std::uint32_t roomCount = 0;
+    const WallDef* walls = nullptr;
+    std::uint32_t wallCount = 0;
+    const DoorDef* doors = nullptr;
+    std::uint32_t doorCount = 0;
+    const ItemDef* items = nullptr;
+    std::uint32_t itemCount = 0;
+    const GuardDef* guards = nullptr;
+    std::uint32_t guardCount = 0;
+    const PatrolPointDef* patrolPoints = nullptr;
+    std::uint32_t patrolPointCount = 0;
+    const PuzzleDef* puzzles = nullptr;
+    std::uint32_t puzzleCount = 0;
+    const GameRule* rules = nullptr;
+    std::uint32_t ruleCount = 0;
+
+    std::int32_t startRoomID = 1;
+    float startX = 100.0f;
+    float startY = 100.0f;
+};
+
+#endif // LEVELDATA_H
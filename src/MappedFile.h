@@ -0,0 +1,34 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+// MappedFile - maps a whole file into memory copy-on-write.
+// Pages are shared with the OS file cache until written, so a loader can patch
+// offsets into pointers in place without touching the file on disk.
+class MappedFile {
+private:
+    void* data;
+    std::size_t size;
+#ifdef _WIN32
+    void* fileHandle;
+    void* mappingHandle;
+#endif
+
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const;
+    unsigned char* getData() const;
+    std::size_t getSize() const;
+};
+
+#endif // MAPPEDFILE_H
@@ -0,0 +1,18 @@
+#ifndef MEMORYSTATS_H
+#define MEMORYSTATS_H
+
+#include <cstddef>
+#include <cstdint>
+
+// MemoryStats - process-wide heap counters. MemoryStats.cpp replaces the
+// global operator new/delete with versions that count every allocation
+// (relaxed atomics, so the cost is one uncontended add) before handing off to
+// malloc/free. Read the counters before and after a stretch of work and
+// subtract to see what it allocated.
+namespace MemoryStats {
+    std::uint64_t allocationCount();  // operator new calls since start-up
+    std::uint64_t allocatedBytes();   // Bytes requested by those calls
+    std::size_t peakResidentBytes();  // Largest resident set so far (0 if unknown)
+}
+
+#endif // MEMORYSTATS_H
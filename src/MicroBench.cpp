@@ -0,0 +1,97 @@
+/*
+ * Museum Escape - Microbenchmark Harness Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "MicroBench.h"
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <cstdlib>
+#include <sstream>
+
+namespace {
+    // Position just past "key": in text, or npos
+    std::size_t findValue(const std::string& text, const std::string& key, std::size_t from) {
+        std::size_t at = text.find("\"" + key + "\":", from);
+        return at == std::string::npos ? at : at + key.size() + 3;
+    }
+}
+
+MicroBench::MicroBench() : sink(0) {}
+
+const std::vector<BenchResult>& MicroBench::getResults() const { return results; }
+
+void MicroBench::print(std::ostream& out) const {
+    out << std::left << std::setw(32) << "benchmark" << std::right << std::setw(14) << "ns/op"
+        << std::setw(14) << "ops" << std::setw(14) << "allocs/op" << std::endl;
+    for (const BenchResult& result : results) {
+        out << std::left << std::setw(32) << result.name << std::right << std::setw(14) << std::fixed
+            << std::setprecision(1) << result.nanosecondsPerOp << std::setw(14) << result.operations
+            << std::setw(14) << std::setprecision(3) << result.allocationsPerOp << std::endl;
+    }
+}
+
+bool MicroBench::writeJson(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary);
+    out << "{\n  \"benchmarks\": [\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        out << "    {\"name\": \"" << results[i].name << "\", \"ns_per_op\": " << std::fixed << std::setprecision(3)
+            << results[i].nanosecondsPerOp << ", \"operations\": " << results[i].operations
+            << ", \"allocs_per_op\": " << results[i].allocationsPerOp << "}"
+            << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n}\n";
+    return static_cast<bool>(out);
+}
+
+bool MicroBench::readJson(const std::string& path, std::vector<BenchResult>& out) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) return false;
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    std::string text = buffer.str();
+
+    out.clear();
+    for (std::size_t at = findValue(text, "name", 0); at != std::string::npos; at = findValue(text, "name", at)) {
+        std::size_t open = text.find('"', at);
+        std::size_t close = open == std::string::npos ? open : text.find('"', open + 1);
+        std::size_t value = findValue(text, "ns_per_op", at);
+        if (close == std::string::npos || value == std::string::npos) return false;
+
+        BenchResult result;
+        result.name = text.substr(open + 1, close - open - 1);
+        result.nanosecondsPerOp = std::strtod(text.c_str() + value, nullptr);
+        std::size_t operations = findValue(text, "operations", at);
+        result.operations = operations == std::string::npos ? 0 : std::strtoull(text.c_str() + operations, nullptr, 10);
+        std::size_t allocations = findValue(text, "allocs_per_op", at);
+        result.allocationsPerOp = allocations == std::string::npos ? 0.0 : std::strtod(text.c_str() + allocations, nullptr);
+        out.push_back(result);
+        at = value;
+    }
+    return !out.empty();
+}
+
+int MicroBench::compare(const std::vector<BenchResult>& baseline, double tolerance, std::ostream& out) const {
+    int regressions = 0;
+    out << std::left << std::setw(32) << "benchmark" << std::right << std::setw(14) << "baseline"
+        << std::setw(14) << "now" << std::setw(10) << "change" << std::endl;
+    for (const BenchResult& result : results) {
+        const BenchResult* before = nullptr;
+        for (const BenchResult& candidate : baseline) {
+            if (candidate.name == result.name) before = &candidate;
+        }
+        out << std::left << std::setw(32) << result.name << std::right << std::fixed << std::setprecision(1);
+        if (!before || before->nanosecondsPerOp <= 0.0) {
+            out << std::setw(14) << "-" << std::setw(14) << result.nanosecondsPerOp << std::setw(10) << "new" << std::endl;
+            continue;
+        }
+        double change = result.nanosecondsPerOp / before->nanosecondsPerOp - 1.0;
+        bool regressed = change > tolerance;
+        if (regressed) ++regressions;
+        out << std::setw(14) << before->nanosecondsPerOp << std::setw(14) << result.nanosecondsPerOp
+            << std::setw(9) << std::showpos << change * 100.0 << std::noshowpos << "%"
+            << (regressed ? "  REGRESSION" : "") << std::endl;
+    }
+    return regressions;
+}
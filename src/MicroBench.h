@@ -0,0 +1,75 @@
+#ifndef MICROBENCH_H
+#define MICROBENCH_H
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include "MemoryStats.h"
+
+struct BenchResult {
+    std::string name;
+    double nanosecondsPerOp;
+    std::uint64_t operations; // Calls timed in total
+    double allocationsPerOp;  // Heap allocations per call, over the timed batches
+};
+
+// MicroBench - times single calls of the game's hot functions
+// (game.exe --microbench). Each benchmark doubles its batch size until one
+// batch runs long enough to time reliably, then reports the median of several
+// batches. Results are written as JSON and can be checked against a baseline
+// file from an earlier run.
+class MicroBench {
+public:
+    static constexpr std::chrono::milliseconds MIN_BATCH_TIME{10};
+    static constexpr std::uint64_t MAX_BATCH = 1ull << 24;
+    static constexpr std::size_t SAMPLES = 7;
+
+private:
+    std::vector<BenchResult> results;
+    volatile std::uint64_t sink; // Results fed to consume() so calls are not optimized away
+
+public:
+    MicroBench();
+
+    // op() is one call of the code under test
+    template<typename Operation>
+    void measure(const std::string& name, Operation op) {
+        using Clock = std::chrono::steady_clock;
+        auto timeBatch = [&op](std::uint64_t batch) {
+            Clock::time_point start = Clock::now();
+            for (std::uint64_t i = 0; i < batch; ++i) op();
+            return Clock::now() - start;
+        };
+
+        std::uint64_t batch = 1;
+        while (batch < MAX_BATCH && timeBatch(batch) < MIN_BATCH_TIME) batch *= 2;
+
+        std::array<double, SAMPLES> perOp;
+        std::uint64_t allocationsBefore = MemoryStats::allocationCount();
+        for (double& sample : perOp) {
+            sample = std::chrono::duration<double, std::nano>(timeBatch(batch)).count() / batch;
+        }
+        double allocations = static_cast<double>(MemoryStats::allocationCount() - allocationsBefore);
+        std::nth_element(perOp.begin(), perOp.begin() + SAMPLES / 2, perOp.end());
+        results.push_back({name, perOp[SAMPLES / 2], batch * SAMPLES, allocations / (batch * SAMPLES)});
+    }
+
+    void consume(std::uint64_t value) { sink = sink + value; }
+
+    const std::vector<BenchResult>& getResults() const;
+    void print(std::ostream& out) const;
+
+    bool writeJson(const std::string& path) const;
+    // Reads files written by writeJson (not general JSON)
+    static bool readJson(const std::string& path, std::vector<BenchResult>& out);
+
+    // Prints each result against the baseline; returns how many got slower by
+    // more than 'tolerance' (0.10 = 10%)
+    int compare(const std::vector<BenchResult>& baseline, double tolerance, std::ostream& out) const;
+};
+
+#endif // MICROBENCH_H
@@ -0,0 +1,291 @@
+/*
+ * Museum Escape - Grid Pathfinding Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "Pathfinding.h"
+#include "CollisionMap.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+namespace {
+    const std::uint32_t UNREACHED = std::numeric_limits<std::uint32_t>::max();
+    const std::uint32_t STRAIGHT_COST = 10;
+    const std::uint32_t DIAGONAL_COST = 14;
+    const int SLICE_EXPANSIONS = 64; // Tiles expanded between budget checks
+
+    const int NEIGHBOUR_DX[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+    const int NEIGHBOUR_DY[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+
+    using HeapEntry = std::pair<std::uint32_t, int>;
+    using MinHeap = std::greater<HeapEntry>;
+
+    // Calls visit(neighbourTile, stepCost) for each walkable neighbour.
+    // Diagonals need both adjacent straight tiles free so paths never clip a corner.
+    template<typename Visit>
+    void forEachNeighbour(const CollisionMap& map, int tile, Visit visit) {
+        int columns = map.getColumns();
+        int column = tile % columns;
+        int row = tile / columns;
+        for (int i = 0; i < 8; ++i) {
+            int nc = column + NEIGHBOUR_DX[i];
+            int nr = row + NEIGHBOUR_DY[i];
+            if (map.isSolidTile(nc, nr)) continue;
+            bool diagonal = i >= 4;
+            if (diagonal && (map.isSolidTile(column + NEIGHBOUR_DX[i], row) ||
+                             map.isSolidTile(column, row + NEIGHBOUR_DY[i]))) continue;
+            visit(nr * columns + nc, diagonal ? DIAGONAL_COST : STRAIGHT_COST);
+        }
+    }
+
+    // Octile distance - exact on an empty 8-connected grid, so A* stays optimal
+    std::uint32_t octileDistance(const CollisionMap& map, int from, int to) {
+        int columns = map.getColumns();
+        std::uint32_t dx = static_cast<std::uint32_t>(std::abs(from % columns - to % columns));
+        std::uint32_t dy = static_cast<std::uint32_t>(std::abs(from / columns - to / columns));
+        return STRAIGHT_COST * (dx + dy) + (DIAGONAL_COST - 2 * STRAIGHT_COST) * std::min(dx, dy);
+    }
+
+    sf::Vector2f normalized(const sf::Vector2f& v) {
+        float length = std::sqrt(v.x * v.x + v.y * v.y);
+        if (length < 0.001f) return {0.0f, 0.0f};
+        return v / length;
+    }
+}
+
+// ============================================================================
+// AStarSearch
+// ============================================================================
+
+AStarSearch::AStarSearch() : map(nullptr), startTile(-1), goalTile(-1), finished(true), found(false) {}
+
+void AStarSearch::reset(const CollisionMap& collisionMap, const sf::Vector2f& from, const sf::Vector2f& to) {
+    map = &collisionMap;
+    startTile = map->tileAt(from);
+    goalTile = map->tileAt(to);
+    goalPoint = to;
+    path.clear();
+    open.clear();
+    found = false;
+    finished = false;
+
+    std::size_t tileCount = static_cast<std::size_t>(map->getTileCount());
+    cost.assign(tileCount, UNREACHED);
+    parent.assign(tileCount, -1);
+
+    if (startTile < 0 || goalTile < 0 || map->isSolidAt(to)) {
+        finished = true;
+        return;
+    }
+    cost[startTile] = 0;
+    open.push_back({octileDistance(*map, startTile, goalTile), startTile});
+}
+
+bool AStarSearch::step(int maxExpansions) {
+    while (!finished && maxExpansions-- > 0) {
+        if (open.empty()) {
+            finished = true;
+            break;
+        }
+        std::pop_heap(open.begin(), open.end(), MinHeap());
+        int tile = open.back().second;
+        std::uint32_t estimate = open.back().first;
+        open.pop_back();
+        if (estimate - octileDistance(*map, tile, goalTile) > cost[tile]) continue; // Stale entry
+
+        if (tile == goalTile) {
+            found = true;
+            finished = true;
+            buildPath();
+            break;
+        }
+
+        forEachNeighbour(*map, tile, [&](int next, std::uint32_t stepCost) {
+            std::uint32_t nextCost = cost[tile] + stepCost;
+            if (nextCost < cost[next]) {
+                cost[next] = nextCost;
+                parent[next] = tile;
+                open.push_back({nextCost + octileDistance(*map, next, goalTile), next});
+                std::push_heap(open.begin(), open.end(), MinHeap());
+            }
+        });
+    }
+    return finished;
+}
+
+void AStarSearch::buildPath() {
+    path.clear();
+    for (int tile = parent[goalTile]; tile != -1 && tile != startTile; tile = parent[tile]) {
+        path.push_back(map->tileCenter(tile));
+    }
+    std::reverse(path.begin(), path.end());
+    path.push_back(goalPoint);
+}
+
+bool AStarSearch::isFinished() const { return finished; }
+bool AStarSearch::wasFound() const { return found; }
+const std::vector<sf::Vector2f>& AStarSearch::getPath() const { return path; }
+
+// ============================================================================
+// FlowField
+// ============================================================================
+
+FlowField::FlowField() : map(nullptr), goalTile(-1), complete(true), lastUsedFrame(0) {}
+
+void FlowField::reset(const CollisionMap& collisionMap, const sf::Vector2f& goal) {
+    map = &collisionMap;
+    goalTile = map->tileAt(goal);
+    goalPoint = goal;
+    open.clear();
+    cost.assign(static_cast<std::size_t>(map->getTileCount()), UNREACHED);
+    complete = goalTile < 0;
+    if (!complete) {
+        cost[goalTile] = 0;
+        open.push_back({0, goalTile});
+    }
+}
+
+bool FlowField::step(int maxExpansions) {
+    while (!complete && maxExpansions-- > 0) {
+        if (open.empty()) {
+            complete = true;
+            break;
+        }
+        std::pop_heap(open.begin(), open.end(), MinHeap());
+        auto [tileCost, tile] = open.back();
+        open.pop_back();
+        if (tileCost > cost[tile]) continue; // Stale entry
+
+        // Moves are symmetric, so walking outwards from the goal gives each tile its distance to it
+        forEachNeighbour(*map, tile, [&](int next, std::uint32_t stepCost) {
+            std::uint32_t nextCost = tileCost + stepCost;
+            if (nextCost < cost[next]) {
+                cost[next] = nextCost;
+                open.push_back({nextCost, next});
+                std::push_heap(open.begin(), open.end(), MinHeap());
+            }
+        });
+    }
+    return complete;
+}
+
+bool FlowField::isComplete() const { return complete; }
+
+sf::Vector2f FlowField::directionFrom(const sf::Vector2f& point) const {
+    if (!complete || !map) return {0.0f, 0.0f};
+    int tile = map->tileAt(point);
+    if (tile < 0 || cost[tile] == UNREACHED) return {0.0f, 0.0f};
+    if (tile == goalTile) return normalized(goalPoint - point);
+
+    int best = -1;
+    std::uint32_t bestCost = cost[tile];
+    forEachNeighbour(*map, tile, [&](int next, std::uint32_t) {
+        if (cost[next] < bestCost) {
+            bestCost = cost[next];
+            best = next;
+        }
+    });
+    if (best < 0) return {0.0f, 0.0f};
+    return normalized(map->tileCenter(best) - point);
+}
+
+float FlowField::distanceFrom(const sf::Vector2f& point) const {
+    if (!map) return -1.0f;
+    int tile = map->tileAt(point);
+    if (tile < 0 || cost[tile] == UNREACHED) return -1.0f;
+    return cost[tile] * CollisionMap::TILE_SIZE / STRAIGHT_COST;
+}
+
+const CollisionMap* FlowField::getMap() const { return map; }
+int FlowField::getGoalTile() const { return goalTile; }
+
+// ============================================================================
+// PathScheduler
+// ============================================================================
+
+PathScheduler::PathScheduler() : frame(1) {}
+
+const FlowField* PathScheduler::requestFlowField(const CollisionMap& map, const sf::Vector2f& goal) {
+    int goalTile = map.tileAt(goal);
+    for (auto& field : fields) {
+        if (field->map == &map && field->goalTile == goalTile) {
+            field->lastUsedFrame = frame;
+            return field.get();
+        }
+    }
+
+    std::unique_ptr<FlowField> field;
+    if (!spareFields.empty()) {
+        field = std::move(spareFields.back());
+        spareFields.pop_back();
+    } else {
+        field = std::make_unique<FlowField>();
+    }
+    field->reset(map, goal);
+    field->lastUsedFrame = frame;
+    if (!field->complete) pendingFields.push_back(field.get());
+    fields.push_back(std::move(field));
+    return fields.back().get();
+}
+
+void PathScheduler::requestPath(AStarSearch& search, const CollisionMap& map, const sf::Vector2f& from, const sf::Vector2f& to) {
+    cancelPath(search);
+    search.reset(map, from, to);
+    if (!search.isFinished()) pendingSearches.push_back(&search);
+}
+
+void PathScheduler::cancelPath(AStarSearch& search) {
+    pendingSearches.erase(std::remove(pendingSearches.begin(), pendingSearches.end(), &search), pendingSearches.end());
+}
+
+void PathScheduler::update(std::chrono::microseconds budget) {
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point deadline = Clock::now() + budget;
+    while (Clock::now() < deadline && stepPending(SLICE_EXPANSIONS)) {}
+    evictUnused();
+}
+
+void PathScheduler::update(int expansions) {
+    for (int left = expansions; left > 0 && stepPending(std::min(left, SLICE_EXPANSIONS)); left -= SLICE_EXPANSIONS) {}
+    evictUnused();
+}
+
+// Shared fields first - each one unblocks every guard waiting on it
+bool PathScheduler::stepPending(int maxExpansions) {
+    if (!pendingFields.empty()) {
+        if (pendingFields.front()->step(maxExpansions)) pendingFields.pop_front();
+    } else if (!pendingSearches.empty()) {
+        if (pendingSearches.front()->step(maxExpansions)) pendingSearches.pop_front();
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Evict fields nobody asked for this frame; keep their buffers for the next request
+void PathScheduler::evictUnused() {
+    for (std::size_t i = 0; i < fields.size();) {
+        if (fields[i]->lastUsedFrame < frame) {
+            FlowField* stale = fields[i].get();
+            pendingFields.erase(std::remove(pendingFields.begin(), pendingFields.end(), stale), pendingFields.end());
+            spareFields.push_back(std::move(fields[i]));
+            fields[i] = std::move(fields.back());
+            fields.pop_back();
+        } else {
+            ++i;
+        }
+    }
+    ++frame;
+}
+
+void PathScheduler::clear() {
+    for (auto& field : fields) spareFields.push_back(std::move(field));
+    fields.clear();
+    pendingFields.clear();
+    pendingSearches.clear();
+}
+
+std::size_t PathScheduler::getFieldCount() const { return fields.size(); }
+std::size_t PathScheduler::getPendingCount() const { return pendingFields.size() + pendingSearches.size(); }
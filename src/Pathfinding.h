@@ -0,0 +1,121 @@
+#ifndef PATHFINDING_H
+#define PATHFINDING_H
+
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+class CollisionMap;
+
+// Grid pathfinding on a room's CollisionMap (one node per tile, 8-connected,
+// no cutting past solid corners). Costs are integers: 10 straight, 14 diagonal.
+//
+// Both searches are incremental - step() expands at most a given number of
+// tiles and can be resumed next frame - so the PathScheduler can slice them
+// under a per-frame budget.
+
+// A* from one point to another, for a single guard (investigating, going home)
+class AStarSearch {
+private:
+    const CollisionMap* map;
+    int startTile;
+    int goalTile;
+    sf::Vector2f goalPoint;
+    std::vector<std::uint32_t> cost;   // Best known cost per tile (UINT32_MAX = unseen)
+    std::vector<std::int32_t> parent;  // Tile we came from (-1 = none)
+    std::vector<std::pair<std::uint32_t, int>> open; // Min-heap of (f, tile)
+    bool finished;
+    bool found;
+    std::vector<sf::Vector2f> path;
+
+public:
+    AStarSearch();
+
+    // Forget any previous search; buffers are kept for reuse
+    void reset(const CollisionMap& collisionMap, const sf::Vector2f& from, const sf::Vector2f& to);
+
+    // Expand up to maxExpansions tiles; true once the search has finished
+    bool step(int maxExpansions);
+
+    bool isFinished() const;
+    bool wasFound() const;
+    const std::vector<sf::Vector2f>& getPath() const; // Tile centres, ending at the exact goal
+
+private:
+    void buildPath();
+};
+
+// Distance-to-goal for every tile of a room, so any number of guards heading
+// for the same spot can each look up their next step in O(1).
+class FlowField {
+private:
+    const CollisionMap* map;
+    int goalTile;
+    sf::Vector2f goalPoint;
+    std::vector<std::uint32_t> cost; // UINT32_MAX = unreached / solid
+    std::vector<std::pair<std::uint32_t, int>> open; // Min-heap of (cost, tile)
+    bool complete;
+    std::uint64_t lastUsedFrame;
+
+public:
+    FlowField();
+
+    void reset(const CollisionMap& collisionMap, const sf::Vector2f& goal);
+    bool step(int maxExpansions); // Dijkstra outwards from the goal
+    bool isComplete() const;
+
+    // Unit vector towards the goal from a point; zero if the point's tile has
+    // not been reached (yet) or has no way to the goal
+    sf::Vector2f directionFrom(const sf::Vector2f& point) const;
+
+    // Walking distance to the goal in pixels; negative if unreached
+    float distanceFrom(const sf::Vector2f& point) const;
+
+    const CollisionMap* getMap() const;
+    int getGoalTile() const;
+
+    friend class PathScheduler;
+};
+
+// PathScheduler - owns flow fields and queued A* searches and advances them
+// within a per-frame budget. Requests for the same room and goal tile share one
+// flow field, so pursuit cost does not grow with the number of pursuers.
+// The budget is time in normal play; fixed-step runs (replays, --bench) give
+// a number of tile expansions instead, so a search finishes on the same frame
+// whatever the machine.
+class PathScheduler {
+private:
+    std::vector<std::unique_ptr<FlowField>> fields; // Live, requested recently
+    std::vector<std::unique_ptr<FlowField>> spareFields; // Evicted, buffers kept
+    std::deque<FlowField*> pendingFields;
+    std::deque<AStarSearch*> pendingSearches; // Owned by the requesters
+    std::uint64_t frame;
+
+public:
+    PathScheduler();
+
+    // The field for the tile containing goal; queued if new. Valid until the
+    // end of the next update() - request it again every frame it is needed.
+    const FlowField* requestFlowField(const CollisionMap& map, const sf::Vector2f& goal);
+
+    // Queue a search owned by the caller; it must stay alive until finished or clear()
+    void requestPath(AStarSearch& search, const CollisionMap& map, const sf::Vector2f& from, const sf::Vector2f& to);
+    void cancelPath(AStarSearch& search);
+
+    // Advance queued work until done or the budget is spent, then drop fields nobody asked for this frame
+    void update(std::chrono::microseconds budget);
+    void update(int expansions);
+
+    void clear();
+    std::size_t getFieldCount() const;
+    std::size_t getPendingCount() const;
+
+private:
+    bool stepPending(int maxExpansions); // False if nothing is queued
+    void evictUnused();
+};
+
+#endif // PATHFINDING_H
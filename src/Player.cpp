@@ -6,6 +6,7 @@
 
 #include "Player.h"
 #include "Item.h"
+#include "Replay.h"
 #include <SFML/Window/Keyboard.hpp>
 
 // Constructor - CHANGED to use Texture
@@ -31,33 +32,39 @@ void Player::move(float dx, float dy) {
     sprite.setPosition(position);
 }
 
-// Handle keyboard input for movement
-void Player::handleInput(float deltaTime) {
+// Return the movement the held keys ask for this frame
+sf::Vector2f Player::handleInput(float deltaTime, unsigned heldKeys) {
     float moveX = 0.0f;
     float moveY = 0.0f;
     
-    // Check WASD keys
+    if (heldKeys & MOVE_UP) moveY -= speed * deltaTime;
+    if (heldKeys & MOVE_DOWN) moveY += speed * deltaTime;
+    if (heldKeys & MOVE_LEFT) moveX -= speed * deltaTime;
+    if (heldKeys & MOVE_RIGHT) moveX += speed * deltaTime;
+    
+    return {moveX, moveY};
+}
+
+// Check WASD / arrow keys (kept apart from handleInput so a replay can stand in)
+unsigned Player::readMoveKeys() {
+    unsigned held = MOVE_NONE;
     if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::W) || 
         sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Up)) {
-        moveY -= speed * deltaTime;
+        held |= MOVE_UP;
     }
     if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::S) || 
         sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Down)) {
-        moveY += speed * deltaTime;
+        held |= MOVE_DOWN;
     }
     if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::A) || 
         sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Left)) {
-        moveX -= speed * deltaTime;
+        held |= MOVE_LEFT;
     }
     if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key::D) || 
         sf::Keyboard::isKeyPressed(sf::Keyboard::Key::Right)) {
-        moveX += speed * deltaTime;
-    }
-    
-    // Apply movement
-    if (moveX != 0.0f || moveY != 0.0f) {
-        move(moveX, moveY);
+        held |= MOVE_RIGHT;
     }
+    return held;
 }
 
 // Set player position
@@ -87,26 +94,34 @@ void Player::addItem(Item* item) {
     inventory.push_back(item);
 }
 
-// Check if player has specific item
-bool Player::hasItem(const std::string& itemName) {
+// Check if player has specific item (integer compare on interned IDs)
+bool Player::hasItem(ItemID itemID) const {
     for (const auto& item : inventory) {
-        if (item->getName() == itemName) {
+        if (item->getID() == itemID) {
             return true;
         }
     }
     return false;
 }
 
+bool Player::hasItem(const std::string& itemName) const {
+    return hasItem(hashItemID(itemName));
+}
+
 // Remove item from inventory
-void Player::removeItem(const std::string& itemName) {
+void Player::removeItem(ItemID itemID) {
     for (auto it = inventory.begin(); it != inventory.end(); ++it) {
-        if ((*it)->getName() == itemName) {
+        if ((*it)->getID() == itemID) {
             inventory.erase(it);
             return;
         }
     }
 }
 
+void Player::removeItem(const std::string& itemName) {
+    removeItem(hashItemID(itemName));
+}
+
 // Get inventory reference
 std::vector<Item*>& Player::getInventory() {
     return inventory;
@@ -128,8 +143,8 @@ void Player::resetWarning() {
 }
 
 // Draw player
-void Player::draw(sf::RenderWindow& window) {
-    window.draw(sprite);
+void Player::draw(RenderQueue& queue) {
+    queue.submit(RenderLayer::Player, sprite);
 }
 
 // Update player (for animations, etc.)
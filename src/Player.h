@@ -5,6 +5,8 @@
 #include <SFML/Graphics.hpp>
 #include <vector>
 #include <string>
+#include "ItemID.h"
+#include "RenderQueue.h"
 
 class Item; // Forward declaration
 class Room; // Forward declaration
@@ -24,7 +26,8 @@ public:
     
     // Movement
     void move(float dx, float dy);
-    void handleInput(float deltaTime);
+    sf::Vector2f handleInput(float deltaTime, unsigned heldKeys); // Requested movement for a MoveKeys mask; the caller resolves collisions
+    static unsigned readMoveKeys(); // Movement keys held on the keyboard right now
     void setPosition(float x, float y);
     sf::Vector2f getPosition() const;
     
@@ -34,7 +37,9 @@ public:
     
     // Inventory management
     void addItem(Item* item);
-    bool hasItem(const std::string& itemName);
+    bool hasItem(ItemID itemID) const;
+    bool hasItem(const std::string& itemName) const;
+    void removeItem(ItemID itemID);
     void removeItem(const std::string& itemName);
     std::vector<Item*>& getInventory();
     
@@ -44,7 +49,7 @@ public:
     void resetWarning();
     
     // Rendering
-    void draw(sf::RenderWindow& window);
+    void draw(RenderQueue& queue);
     void update(float deltaTime);
 };
 
@@ -4,9 +4,16 @@
  */
 
 #include "Puzzle.h"
+#include "Item.h"
+#include "RenderStats.h"
 #include <algorithm>
 #include <cctype>
 
+namespace {
+    // Pattern switches, left to right; patterns number them from 1
+    const char* const SWITCH_NAMES[] = { "Blue", "Red", "Green", "Yellow" };
+}
+
 // Puzzle Base Class
 Puzzle::Puzzle(const std::string& desc, const std::string& hintText, int bonus, int penalty)
     : isSolved(false), description(desc), hint(hintText), timeBonus(bonus), timePenalty(penalty) {}
@@ -55,11 +62,11 @@ bool RiddlePuzzle::solve(const std::string& answer) {
     }
 }
 
-void RiddlePuzzle::display(sf::RenderWindow& window) {
+void RiddlePuzzle::display(sf::RenderTarget& target) {
     // Dark overlay
     sf::RectangleShape overlay({800.0f, 600.0f});
     overlay.setFillColor(sf::Color(0, 0, 0, 180));
-    window.draw(overlay);
+    drawCounted(target, overlay);
     
     // Puzzle box
     sf::RectangleShape puzzleBox({600.0f, 400.0f});
@@ -67,7 +74,7 @@ void RiddlePuzzle::display(sf::RenderWindow& window) {
     puzzleBox.setFillColor(sf::Color(40, 40, 60));
     puzzleBox.setOutlineThickness(3.0f);
     puzzleBox.setOutlineColor(sf::Color::White);
-    window.draw(puzzleBox);
+    drawCounted(target, puzzleBox);
     
     // Title
     sf::Text title(font);
@@ -75,7 +82,7 @@ void RiddlePuzzle::display(sf::RenderWindow& window) {
     title.setCharacterSize(28);
     title.setFillColor(sf::Color::Yellow);
     title.setPosition({250.0f, 120.0f});
-    window.draw(title);
+    drawCounted(target, title);
     
     // Riddle text
     riddleText.setFont(font);
@@ -83,7 +90,7 @@ void RiddlePuzzle::display(sf::RenderWindow& window) {
     riddleText.setCharacterSize(20);
     riddleText.setFillColor(sf::Color::White);
     riddleText.setPosition({130.0f, 180.0f});
-    window.draw(riddleText);
+    drawCounted(target, riddleText);
     
     // Input prompt
     sf::Text promptText(font);
@@ -91,7 +98,7 @@ void RiddlePuzzle::display(sf::RenderWindow& window) {
     promptText.setCharacterSize(18);
     promptText.setFillColor(sf::Color::Cyan);
     promptText.setPosition({130.0f, 320.0f});
-    window.draw(promptText);
+    drawCounted(target, promptText);
     
     // Input box
     sf::RectangleShape inputBox({540.0f, 40.0f});
@@ -99,7 +106,7 @@ void RiddlePuzzle::display(sf::RenderWindow& window) {
     inputBox.setFillColor(sf::Color(20, 20, 30));
     inputBox.setOutlineThickness(2.0f);
     inputBox.setOutlineColor(sf::Color::White);
-    window.draw(inputBox);
+    drawCounted(target, inputBox);
     
     // User input text
     inputText.setFont(font);
@@ -107,7 +114,7 @@ void RiddlePuzzle::display(sf::RenderWindow& window) {
     inputText.setCharacterSize(20);
     inputText.setFillColor(sf::Color::White);
     inputText.setPosition({140.0f, 357.0f});
-    window.draw(inputText);
+    drawCounted(target, inputText);
     
     // Feedback message
     if (showFeedback) {
@@ -122,7 +129,7 @@ void RiddlePuzzle::display(sf::RenderWindow& window) {
         }
         
         feedback.setPosition({130.0f, 410.0f});
-        window.draw(feedback);
+        drawCounted(target, feedback);
     }
     
     // Instructions
@@ -131,7 +138,7 @@ void RiddlePuzzle::display(sf::RenderWindow& window) {
     instructions.setCharacterSize(16);
     instructions.setFillColor(sf::Color(150, 150, 150));
     instructions.setPosition({200.0f, 460.0f});
-    window.draw(instructions);
+    drawCounted(target, instructions);
 }
 
 void RiddlePuzzle::handleInput(sf::Event& event) {
@@ -160,10 +167,6 @@ void RiddlePuzzle::handleInput(sf::Event& event) {
     }
 }
 
-void RiddlePuzzle::update(float deltaTime) {
-    // Animation or timer logic could go here
-}
-
 void RiddlePuzzle::setFont(const sf::Font& f) {
     font = f;
     riddleText.setFont(font);
@@ -200,17 +203,28 @@ PatternPuzzle::PatternPuzzle(const std::vector<int>& pattern)
         button.setOutlineColor(sf::Color::White);
         switches.push_back(button);
     }
+    
+    // The order to click, spelled out from the pattern itself
+    std::string order = "Click the switches in this order:\n";
+    for (std::size_t i = 0; i < correctPattern.size(); ++i) {
+        if (i > 0) order += " -> ";
+        order += SWITCH_NAMES[correctPattern[i] - 1];
+    }
+    instructionText.setString(order);
+    instructionText.setCharacterSize(20);
+    instructionText.setFillColor(sf::Color::White);
+    instructionText.setPosition({150.0f, 150.0f});
 }
 
 bool PatternPuzzle::solve(const std::string& answer) {
     return checkPattern();
 }
 
-void PatternPuzzle::display(sf::RenderWindow& window) {
+void PatternPuzzle::display(sf::RenderTarget& target) {
     // Dark overlay
     sf::RectangleShape overlay({800.0f, 600.0f});
     overlay.setFillColor(sf::Color(0, 0, 0, 180));
-    window.draw(overlay);
+    drawCounted(target, overlay);
     
     // Puzzle box
     sf::RectangleShape puzzleBox({600.0f, 450.0f});
@@ -218,7 +232,7 @@ void PatternPuzzle::display(sf::RenderWindow& window) {
     puzzleBox.setFillColor(sf::Color(40, 40, 60));
     puzzleBox.setOutlineThickness(3.0f);
     puzzleBox.setOutlineColor(sf::Color::White);
-    window.draw(puzzleBox);
+    drawCounted(target, puzzleBox);
     
     // Title
     sf::Text title(font);
@@ -226,33 +240,27 @@ void PatternPuzzle::display(sf::RenderWindow& window) {
     title.setCharacterSize(28);
     title.setFillColor(sf::Color::Yellow);
     title.setPosition({250.0f, 95.0f});
-    window.draw(title);
+    drawCounted(target, title);
     
     // Instructions
-    sf::Text instructions(font);
-    instructions.setString("Click the switches in this order:\nBlue -> Green -> Red -> Yellow");
-    instructions.setCharacterSize(20);
-    instructions.setFillColor(sf::Color::White);
-    instructions.setPosition({150.0f, 150.0f});
-    window.draw(instructions);
+    drawCounted(target, instructionText);
     
     // Your sequence
     sf::Text sequenceText(font);
     std::string seq = "Your sequence: ";
     for (size_t i = 0; i < playerPattern.size(); i++) {
-        std::vector<std::string> names = {"Blue", "Red", "Green", "Yellow"};
         if (i > 0) seq += " -> ";
-        seq += names[playerPattern[i] - 1];
+        seq += SWITCH_NAMES[playerPattern[i] - 1];
     }
     sequenceText.setString(seq);
     sequenceText.setCharacterSize(18);
     sequenceText.setFillColor(sf::Color::Cyan);
     sequenceText.setPosition({150.0f, 240.0f});
-    window.draw(sequenceText);
+    drawCounted(target, sequenceText);
     
     // Draw switches
     for (auto& sw : switches) {
-        window.draw(sw);
+        drawCounted(target, sw);
     }
     
     // Instructions
@@ -261,7 +269,7 @@ void PatternPuzzle::display(sf::RenderWindow& window) {
     controls.setCharacterSize(16);
     controls.setFillColor(sf::Color(150, 150, 150));
     controls.setPosition({180.0f, 480.0f});
-    window.draw(controls);
+    drawCounted(target, controls);
 }
 
 void PatternPuzzle::handleInput(sf::Event& event) {
@@ -301,10 +309,6 @@ void PatternPuzzle::handleInput(sf::Event& event) {
     }
 }
 
-void PatternPuzzle::update(float deltaTime) {
-    // Could add animations here
-}
-
 void PatternPuzzle::setFont(const sf::Font& f) {
     font = f;
     instructionText.setFont(font);
@@ -348,11 +352,11 @@ bool LockPuzzle::solve(const std::string& answer) {
     return false;
 }
 
-void LockPuzzle::display(sf::RenderWindow& window) {
+void LockPuzzle::display(sf::RenderTarget& target) {
     // Dark overlay
     sf::RectangleShape overlay({800.0f, 600.0f});
     overlay.setFillColor(sf::Color(0, 0, 0, 180));
-    window.draw(overlay);
+    drawCounted(target, overlay);
     
     // Puzzle box - SMALLER to fit everything
     sf::RectangleShape puzzleBox({550.0f, 550.0f});
@@ -360,7 +364,7 @@ void LockPuzzle::display(sf::RenderWindow& window) {
     puzzleBox.setFillColor(sf::Color(40, 40, 60));
     puzzleBox.setOutlineThickness(3.0f);
     puzzleBox.setOutlineColor(sf::Color::White);
-    window.draw(puzzleBox);
+    drawCounted(target, puzzleBox);
     
     // Title
     sf::Text title(font);
@@ -368,7 +372,7 @@ void LockPuzzle::display(sf::RenderWindow& window) {
     title.setCharacterSize(26);
     title.setFillColor(sf::Color::Yellow);
     title.setPosition({310.0f, 40.0f});
-    window.draw(title);
+    drawCounted(target, title);
     
     // Instructions
     sf::Text instructions(font);
@@ -376,7 +380,7 @@ void LockPuzzle::display(sf::RenderWindow& window) {
     instructions.setCharacterSize(18);
     instructions.setFillColor(sf::Color::White);
     instructions.setPosition({280.0f, 80.0f});
-    window.draw(instructions);
+    drawCounted(target, instructions);
     
     // Code display box
     sf::RectangleShape displayBox({300.0f, 50.0f});
@@ -384,7 +388,7 @@ void LockPuzzle::display(sf::RenderWindow& window) {
     displayBox.setFillColor(sf::Color(20, 20, 30));
     displayBox.setOutlineThickness(3.0f);
     displayBox.setOutlineColor(sf::Color::Cyan);
-    window.draw(displayBox);
+    drawCounted(target, displayBox);
     
     // Display entered code
     std::string displayCode = "";
@@ -403,7 +407,7 @@ void LockPuzzle::display(sf::RenderWindow& window) {
     codeDisplay.setCharacterSize(32);
     codeDisplay.setFillColor(sf::Color::White);
     codeDisplay.setPosition({290.0f, 125.0f});
-    window.draw(codeDisplay);
+    drawCounted(target, codeDisplay);
     
     // Draw numeric keypad - ADJUSTED POSITIONS AND SMALLER BUTTONS
     float keypadStartX = 235.0f;
@@ -425,7 +429,7 @@ void LockPuzzle::display(sf::RenderWindow& window) {
         button.setFillColor(sf::Color(60, 60, 80));
         button.setOutlineThickness(2.0f);
         button.setOutlineColor(sf::Color::White);
-        window.draw(button);
+        drawCounted(target, button);
         
         // Button number
         sf::Text buttonText(font);
@@ -433,7 +437,7 @@ void LockPuzzle::display(sf::RenderWindow& window) {
         buttonText.setCharacterSize(28);
         buttonText.setFillColor(sf::Color::White);
         buttonText.setPosition({x + 23.0f, y + 15.0f});
-        window.draw(buttonText);
+        drawCounted(target, buttonText);
     }
     
     // Bottom row: Clear, 0, Enter
@@ -443,14 +447,14 @@ void LockPuzzle::display(sf::RenderWindow& window) {
     clearButton.setFillColor(sf::Color(100, 50, 50));
     clearButton.setOutlineThickness(2.0f);
     clearButton.setOutlineColor(sf::Color::White);
-    window.draw(clearButton);
+    drawCounted(target, clearButton);
     
     sf::Text clearText(font);
     clearText.setString("C");
     clearText.setCharacterSize(26);
     clearText.setFillColor(sf::Color::White);
     clearText.setPosition({keypadStartX + 23.0f, keypadStartY + 3 * spacing + 16.0f});
-    window.draw(clearText);
+    drawCounted(target, clearText);
     
     // 0 button
     sf::RectangleShape zeroButton({buttonSize, buttonSize});
@@ -458,14 +462,14 @@ void LockPuzzle::display(sf::RenderWindow& window) {
     zeroButton.setFillColor(sf::Color(60, 60, 80));
     zeroButton.setOutlineThickness(2.0f);
     zeroButton.setOutlineColor(sf::Color::White);
-    window.draw(zeroButton);
+    drawCounted(target, zeroButton);
     
     sf::Text zeroText(font);
     zeroText.setString("0");
     zeroText.setCharacterSize(28);
     zeroText.setFillColor(sf::Color::White);
     zeroText.setPosition({keypadStartX + spacing + 23.0f, keypadStartY + 3 * spacing + 15.0f});
-    window.draw(zeroText);
+    drawCounted(target, zeroText);
     
     // OK button
     sf::RectangleShape enterButton({buttonSize, buttonSize});
@@ -473,14 +477,14 @@ void LockPuzzle::display(sf::RenderWindow& window) {
     enterButton.setFillColor(sf::Color(50, 100, 50));
     enterButton.setOutlineThickness(2.0f);
     enterButton.setOutlineColor(sf::Color::White);
-    window.draw(enterButton);
+    drawCounted(target, enterButton);
     
     sf::Text enterText(font);
     enterText.setString("OK");
     enterText.setCharacterSize(22);
     enterText.setFillColor(sf::Color::White);
     enterText.setPosition({keypadStartX + 2 * spacing + 15.0f, keypadStartY + 3 * spacing + 18.0f});
-    window.draw(enterText);
+    drawCounted(target, enterText);
     
     // Feedback message
     if (isSolved) {
@@ -489,7 +493,7 @@ void LockPuzzle::display(sf::RenderWindow& window) {
         feedback.setCharacterSize(20);
         feedback.setFillColor(sf::Color::Green);
         feedback.setPosition({235.0f, 510.0f});
-        window.draw(feedback);
+        drawCounted(target, feedback);
     }
     
     // Instructions at bottom
@@ -498,7 +502,7 @@ void LockPuzzle::display(sf::RenderWindow& window) {
     controls.setCharacterSize(15);
     controls.setFillColor(sf::Color(150, 150, 150));
     controls.setPosition({220.0f, 545.0f});
-    window.draw(controls);
+    drawCounted(target, controls);
 }
 void LockPuzzle::handleInput(sf::Event& event) {
     if (isSolved) return;  // Don't accept input if already solved
@@ -581,10 +585,6 @@ void LockPuzzle::handleInput(sf::Event& event) {
     }
 }
 
-void LockPuzzle::update(float deltaTime) {
-    // Animation or timer logic could go here
-}
-
 void LockPuzzle::setFont(const sf::Font& f) {
     font = f;
     codeDisplay.setFont(font);
@@ -648,11 +648,11 @@ bool MathPuzzle::solve(const std::string& answer) {
     return false;
 }
 
-void MathPuzzle::display(sf::RenderWindow& window) {
+void MathPuzzle::display(sf::RenderTarget& target) {
     // Dark overlay
     sf::RectangleShape overlay({800.0f, 600.0f});
     overlay.setFillColor(sf::Color(0, 0, 0, 180));
-    window.draw(overlay);
+    drawCounted(target, overlay);
     
     // Puzzle box
     sf::RectangleShape puzzleBox({600.0f, 500.0f});
@@ -660,7 +660,7 @@ void MathPuzzle::display(sf::RenderWindow& window) {
     puzzleBox.setFillColor(sf::Color(40, 40, 60));
     puzzleBox.setOutlineThickness(3.0f);
     puzzleBox.setOutlineColor(sf::Color::Cyan);
-    window.draw(puzzleBox);
+    drawCounted(target, puzzleBox);
     
     // Title
     sf::Text title(font);
@@ -668,7 +668,7 @@ void MathPuzzle::display(sf::RenderWindow& window) {
     title.setCharacterSize(26);
     title.setFillColor(sf::Color::Cyan);
     title.setPosition({220.0f, 70.0f});
-    window.draw(title);
+    drawCounted(target, title);
     
     // Instructions
     sf::Text instructions(font);
@@ -676,13 +676,13 @@ void MathPuzzle::display(sf::RenderWindow& window) {
     instructions.setCharacterSize(18);
     instructions.setFillColor(sf::Color::White);
     instructions.setPosition({200.0f, 120.0f});
-    window.draw(instructions);
+    drawCounted(target, instructions);
     
     // Equation display
     equationText.setFont(font);
     equationText.setString(equation);
     equationText.setPosition({300.0f, 180.0f});
-    window.draw(equationText);
+    drawCounted(target, equationText);
     
     // Answer label
     sf::Text answerLabel(font);
@@ -690,7 +690,7 @@ void MathPuzzle::display(sf::RenderWindow& window) {
     answerLabel.setCharacterSize(20);
     answerLabel.setFillColor(sf::Color::White);
     answerLabel.setPosition({250.0f, 250.0f});
-    window.draw(answerLabel);
+    drawCounted(target, answerLabel);
     
     // Answer input box
     sf::RectangleShape answerBox({200.0f, 50.0f});
@@ -698,7 +698,7 @@ void MathPuzzle::display(sf::RenderWindow& window) {
     answerBox.setFillColor(sf::Color(20, 20, 30));
     answerBox.setOutlineThickness(3.0f);
     answerBox.setOutlineColor(sf::Color::Cyan);
-    window.draw(answerBox);
+    drawCounted(target, answerBox);
     
     // Display entered answer with underscores
     std::string displayAnswer = "";
@@ -713,7 +713,7 @@ void MathPuzzle::display(sf::RenderWindow& window) {
     answerDisplay.setFont(font);
     answerDisplay.setString(displayAnswer);
     answerDisplay.setPosition({330.0f, 300.0f});
-    window.draw(answerDisplay);
+    drawCounted(target, answerDisplay);
     
     // Numeric keypad (simplified 3x3 + bottom row)
     float keypadX = 250.0f;
@@ -734,14 +734,14 @@ void MathPuzzle::display(sf::RenderWindow& window) {
         button.setFillColor(sf::Color(60, 60, 80));
         button.setOutlineThickness(2.0f);
         button.setOutlineColor(sf::Color::White);
-        window.draw(button);
+        drawCounted(target, button);
         
         sf::Text num(font);
         num.setString(std::to_string(i));
         num.setCharacterSize(24);
         num.setFillColor(sf::Color::White);
         num.setPosition({x + 22.0f, y + 15.0f});
-        window.draw(num);
+        drawCounted(target, num);
     }
     
     // Bottom row: Clear, 0, Submit
@@ -751,14 +751,14 @@ void MathPuzzle::display(sf::RenderWindow& window) {
     clearBtn.setFillColor(sf::Color(100, 50, 50));
     clearBtn.setOutlineThickness(2.0f);
     clearBtn.setOutlineColor(sf::Color::White);
-    window.draw(clearBtn);
+    drawCounted(target, clearBtn);
     
     sf::Text clearText(font);
     clearText.setString("C");
     clearText.setCharacterSize(22);
     clearText.setFillColor(sf::Color::White);
     clearText.setPosition({keypadX + 22.0f, keypadY + 3 * spacing + 16.0f});
-    window.draw(clearText);
+    drawCounted(target, clearText);
     
     // 0 button
     sf::RectangleShape zeroBtn({buttonSize, buttonSize});
@@ -766,14 +766,14 @@ void MathPuzzle::display(sf::RenderWindow& window) {
     zeroBtn.setFillColor(sf::Color(60, 60, 80));
     zeroBtn.setOutlineThickness(2.0f);
     zeroBtn.setOutlineColor(sf::Color::White);
-    window.draw(zeroBtn);
+    drawCounted(target, zeroBtn);
     
     sf::Text zeroText(font);
     zeroText.setString("0");
     zeroText.setCharacterSize(24);
     zeroText.setFillColor(sf::Color::White);
     zeroText.setPosition({keypadX + spacing + 22.0f, keypadY + 3 * spacing + 15.0f});
-    window.draw(zeroText);
+    drawCounted(target, zeroText);
     
     // Submit button
     sf::RectangleShape submitBtn({buttonSize, buttonSize});
@@ -781,14 +781,14 @@ void MathPuzzle::display(sf::RenderWindow& window) {
     submitBtn.setFillColor(sf::Color(50, 100, 50));
     submitBtn.setOutlineThickness(2.0f);
     submitBtn.setOutlineColor(sf::Color::White);
-    window.draw(submitBtn);
+    drawCounted(target, submitBtn);
     
     sf::Text submitText(font);
     submitText.setString("OK");
     submitText.setCharacterSize(20);
     submitText.setFillColor(sf::Color::White);
     submitText.setPosition({keypadX + 2 * spacing + 16.0f, keypadY + 3 * spacing + 18.0f});
-    window.draw(submitText);
+    drawCounted(target, submitText);
     
     // Feedback
     if (isSolved) {
@@ -797,7 +797,7 @@ void MathPuzzle::display(sf::RenderWindow& window) {
         feedback.setCharacterSize(18);
         feedback.setFillColor(sf::Color::Green);
         feedback.setPosition({200.0f, 520.0f});
-        window.draw(feedback);
+        drawCounted(target, feedback);
     }
     
     // Instructions
@@ -806,7 +806,7 @@ void MathPuzzle::display(sf::RenderWindow& window) {
     controls.setCharacterSize(14);
     controls.setFillColor(sf::Color(150, 150, 150));
     controls.setPosition({220.0f, 540.0f});
-    window.draw(controls);
+    drawCounted(target, controls);
 }
 
 void MathPuzzle::handleInput(sf::Event& event) {
@@ -886,10 +886,6 @@ void MathPuzzle::handleInput(sf::Event& event) {
     }
 }
 
-void MathPuzzle::update(float deltaTime) {
-    // No animation needed for math puzzle
-}
-
 void MathPuzzle::setFont(const sf::Font& f) {
     font = f;
     equationText.setFont(font);
@@ -944,11 +940,11 @@ bool WirePuzzle::solve(const std::string& answer) {
     return false;
 }
 
-void WirePuzzle::display(sf::RenderWindow& window) {
+void WirePuzzle::display(sf::RenderTarget& target) {
     // Dark overlay
     sf::RectangleShape overlay({800.0f, 600.0f});
     overlay.setFillColor(sf::Color(0, 0, 0, 180));
-    window.draw(overlay);
+    drawCounted(target, overlay);
     
     // Puzzle box
     sf::RectangleShape puzzleBox({650.0f, 550.0f});
@@ -956,7 +952,7 @@ void WirePuzzle::display(sf::RenderWindow& window) {
     puzzleBox.setFillColor(sf::Color(40, 40, 60));
     puzzleBox.setOutlineThickness(3.0f);
     puzzleBox.setOutlineColor(sf::Color(255, 100, 100)); // Red outline for danger
-    window.draw(puzzleBox);
+    drawCounted(target, puzzleBox);
     
     // Title
     sf::Text title(font);
@@ -964,7 +960,7 @@ void WirePuzzle::display(sf::RenderWindow& window) {
     title.setCharacterSize(28);
     title.setFillColor(sf::Color(255, 100, 100));
     title.setPosition({250.0f, 45.0f});
-    window.draw(title);
+    drawCounted(target, title);
     
     // Instructions
     sf::Text instructions(font);
@@ -977,7 +973,7 @@ void WirePuzzle::display(sf::RenderWindow& window) {
     }
     instructions.setCharacterSize(18);
     instructions.setPosition({180.0f, 90.0f});
-    window.draw(instructions);
+    drawCounted(target, instructions);
     
     // Hint
     sf::Text hintText(font);
@@ -985,7 +981,7 @@ void WirePuzzle::display(sf::RenderWindow& window) {
     hintText.setCharacterSize(16);
     hintText.setFillColor(sf::Color(200, 200, 100));
     hintText.setPosition({200.0f, 120.0f});
-    window.draw(hintText);
+    drawCounted(target, hintText);
     
     // Draw wires
     float wireStartY = 180.0f;
@@ -1005,13 +1001,13 @@ void WirePuzzle::display(sf::RenderWindow& window) {
             sf::RectangleShape wireLeft({180.0f, 25.0f});
             wireLeft.setPosition({200.0f, y});
             wireLeft.setFillColor(sf::Color(80, 80, 80)); // Gray when cut
-            window.draw(wireLeft);
+            drawCounted(target, wireLeft);
             
             // Right half
             sf::RectangleShape wireRight({180.0f, 25.0f});
             wireRight.setPosition({420.0f, y});
             wireRight.setFillColor(sf::Color(80, 80, 80));
-            window.draw(wireRight);
+            drawCounted(target, wireRight);
             
             // Cut mark (X)
             sf::Text cutMark(font);
@@ -1019,10 +1015,10 @@ void WirePuzzle::display(sf::RenderWindow& window) {
             cutMark.setCharacterSize(30);
             cutMark.setFillColor(sf::Color::White);
             cutMark.setPosition({385.0f, y - 8.0f});
-            window.draw(cutMark);
+            drawCounted(target, cutMark);
         } else {
             // Wire is intact
-            window.draw(wireBg);
+            drawCounted(target, wireBg);
         }
         
         // Wire label
@@ -1031,7 +1027,7 @@ void WirePuzzle::display(sf::RenderWindow& window) {
         label.setCharacterSize(18);
         label.setFillColor(sf::Color::White);
         label.setPosition({100.0f, y + 2.0f});
-        window.draw(label);
+        drawCounted(target, label);
         
         // Click button (if not cut and have bolt cutters)
         if (!wireCut[i] && hasBoltCutters) {
@@ -1040,14 +1036,14 @@ void WirePuzzle::display(sf::RenderWindow& window) {
             cutButton.setFillColor(sf::Color(100, 50, 50));
             cutButton.setOutlineThickness(2.0f);
             cutButton.setOutlineColor(sf::Color::White);
-            window.draw(cutButton);
+            drawCounted(target, cutButton);
             
             sf::Text cutText(font);
             cutText.setString("CUT");
             cutText.setCharacterSize(14);
             cutText.setFillColor(sf::Color::White);
             cutText.setPosition({630.0f, y + 5.0f});
-            window.draw(cutText);
+            drawCounted(target, cutText);
         }
     }
     
@@ -1057,7 +1053,7 @@ void WirePuzzle::display(sf::RenderWindow& window) {
     sequenceLabel.setCharacterSize(18);
     sequenceLabel.setFillColor(sf::Color::White);
     sequenceLabel.setPosition({100.0f, 480.0f});
-    window.draw(sequenceLabel);
+    drawCounted(target, sequenceLabel);
     
     std::string sequenceStr = "";
     for (size_t i = 0; i < cutSequence.size(); i++) {
@@ -1070,7 +1066,7 @@ void WirePuzzle::display(sf::RenderWindow& window) {
     sequenceDisplay.setCharacterSize(16);
     sequenceDisplay.setFillColor(sf::Color::Cyan);
     sequenceDisplay.setPosition({100.0f, 510.0f});
-    window.draw(sequenceDisplay);
+    drawCounted(target, sequenceDisplay);
     
     // Feedback
     if (isSolved) {
@@ -1079,7 +1075,7 @@ void WirePuzzle::display(sf::RenderWindow& window) {
         feedback.setCharacterSize(18);
         feedback.setFillColor(sf::Color::Green);
         feedback.setPosition({180.0f, 540.0f});
-        window.draw(feedback);
+        drawCounted(target, feedback);
     } else if (cutSequence.size() > 0 && cutSequence.size() == correctSequence.size()) {
         // Wrong sequence
         sf::Text feedback(font);
@@ -1087,7 +1083,7 @@ void WirePuzzle::display(sf::RenderWindow& window) {
         feedback.setCharacterSize(18);
         feedback.setFillColor(sf::Color::Red);
         feedback.setPosition({160.0f, 540.0f});
-        window.draw(feedback);
+        drawCounted(target, feedback);
     }
     
     // Controls
@@ -1096,7 +1092,7 @@ void WirePuzzle::display(sf::RenderWindow& window) {
     controls.setCharacterSize(14);
     controls.setFillColor(sf::Color(150, 150, 150));
     controls.setPosition({250.0f, 555.0f});
-    window.draw(controls);
+    drawCounted(target, controls);
 }
 
 void WirePuzzle::handleInput(sf::Event& event) {
@@ -1129,14 +1125,15 @@ void WirePuzzle::handleInput(sf::Event& event) {
     }
 }
 
-void WirePuzzle::update(float deltaTime) {
-    // No animation needed
-}
-
 void WirePuzzle::setFont(const sf::Font& f) {
     font = f;
 }
 
+// Bolt cutters are a bitmask test on the inventory, so just re-check on every open
+void WirePuzzle::onActivate(const Inventory& inventory) {
+    hasBoltCutters = inventory.hasTool(ToolType::BoltCutters);
+}
+
 void WirePuzzle::setBoltCutters(bool has) {
     hasBoltCutters = has;
 }
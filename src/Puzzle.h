@@ -3,9 +3,14 @@
 
 #include <SFML/Graphics.hpp>
 #include <string>
+#include <variant>
 #include <vector>
 
-// Abstract base class for all puzzles
+class Inventory; // Forward declaration
+
+// Common state shared by all puzzles. There is no vtable: the concrete puzzles
+// are stored in a PuzzleVariant (below) and dispatched with std::visit, so each
+// one provides solve/display/handleInput/update/onActivate as plain members.
 class Puzzle {
 protected:
     bool isSolved;
@@ -18,14 +23,7 @@ public:
     // Constructor
     Puzzle(const std::string& desc, const std::string& hintText, int bonus = 30, int penalty = 10);
     
-    // Virtual destructor for proper cleanup
-    virtual ~Puzzle() = default;
-    
-    // Pure virtual functions (must be implemented by derived classes)
-    virtual bool solve(const std::string& answer) = 0;
-    virtual void display(sf::RenderWindow& window) = 0;
-    virtual void handleInput(sf::Event& event) = 0;
-    virtual void update(float deltaTime) = 0;
+    void onActivate(const Inventory& /*inventory*/) {} // Called when the player opens the puzzle
     
     // Common functions
     bool isSolvedStatus() const;
@@ -52,10 +50,10 @@ private:
 public:
     RiddlePuzzle(const std::string& riddleText, const std::string& answer);
     
-    bool solve(const std::string& answer) override;
-    void display(sf::RenderWindow& window) override;
-    void handleInput(sf::Event& event) override;
-    void update(float deltaTime) override;
+    bool solve(const std::string& answer);
+    void display(sf::RenderTarget& target);
+    void handleInput(sf::Event& event);
+    void update(float /*deltaTime*/) {}
     
     void setFont(const sf::Font& f);
 };
@@ -74,10 +72,10 @@ private:
 public:
     PatternPuzzle(const std::vector<int>& pattern);
     
-    bool solve(const std::string& answer) override;
-    void display(sf::RenderWindow& window) override;
-    void handleInput(sf::Event& event) override;
-    void update(float deltaTime) override;
+    bool solve(const std::string& answer);
+    void display(sf::RenderTarget& target);
+    void handleInput(sf::Event& event);
+    void update(float /*deltaTime*/) {}
     
     void setFont(const sf::Font& f);
     bool checkPattern();
@@ -98,10 +96,10 @@ private:
 public:
     LockPuzzle(const std::string& code);
     
-    bool solve(const std::string& answer) override;
-    void display(sf::RenderWindow& window) override;
-    void handleInput(sf::Event& event) override;
-    void update(float deltaTime) override;
+    bool solve(const std::string& answer);
+    void display(sf::RenderTarget& target);
+    void handleInput(sf::Event& event);
+    void update(float /*deltaTime*/) {}
     
     void setFont(const sf::Font& f);
     void addDigit(char digit);
@@ -128,10 +126,10 @@ private:
 public:
     MathPuzzle(const std::string& eq, const std::string& answer);
     
-    bool solve(const std::string& answer) override;
-    void display(sf::RenderWindow& window) override;
-    void handleInput(sf::Event& event) override;
-    void update(float deltaTime) override;
+    bool solve(const std::string& answer);
+    void display(sf::RenderTarget& target);
+    void handleInput(sf::Event& event);
+    void update(float /*deltaTime*/) {}
     
     void setFont(const sf::Font& f);
     void addDigit(char digit);
@@ -155,10 +153,11 @@ private:
 public:
     WirePuzzle(const std::vector<std::string>& sequence);
     
-    bool solve(const std::string& answer) override;
-    void display(sf::RenderWindow& window) override;
-    void handleInput(sf::Event& event) override;
-    void update(float deltaTime) override;
+    bool solve(const std::string& answer);
+    void display(sf::RenderTarget& target);
+    void handleInput(sf::Event& event);
+    void update(float /*deltaTime*/) {}
+    void onActivate(const Inventory& inventory);
     
     void setFont(const sf::Font& f);
     void setBoltCutters(bool has);
@@ -166,4 +165,16 @@ public:
     sf::Color getWireColor(const std::string& colorName);
 };
 
+// Every puzzle type, held by value. Visiting a variant is a jump on its index
+// with the member call inlined, and a level's puzzles sit in one array.
+using PuzzleVariant = std::variant<RiddlePuzzle, PatternPuzzle, LockPuzzle, MathPuzzle, WirePuzzle>;
+
+inline Puzzle& puzzleBase(PuzzleVariant& puzzle) {
+    return std::visit([](Puzzle& base) -> Puzzle& { return base; }, puzzle);
+}
+
+inline const Puzzle& puzzleBase(const PuzzleVariant& puzzle) {
+    return std::visit([](const Puzzle& base) -> const Puzzle& { return base; }, puzzle);
+}
+
 #endif // PUZZLE_H
\ No newline at end of file
@@ -0,0 +1,85 @@
+/*
+ * Museum Escape - Render Queue Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "RenderQueue.h"
+#include "RenderStats.h"
+#include <algorithm>
+
+namespace {
+    const unsigned LAYER_SHIFT = 56;
+    const unsigned STATE_SHIFT = 48;
+    const std::uint64_t STATE_MASK = 0xFF;
+    const std::uint64_t TEXTURE_MASK = 0xFFFFFFFFFFFFull; // GL texture names are small
+
+    std::uint64_t stateOf(std::uint64_t key) { return key & ~(std::uint64_t(0xFF) << LAYER_SHIFT); }
+}
+
+// Blend/shader pairs are numbered as they are first seen; the few the game
+// uses stay in the table for good
+std::uint64_t RenderQueue::stateId(const sf::RenderStates& states) {
+    for (std::size_t i = 0; i < stateIds.size(); ++i) {
+        if (stateIds[i].first == states.blendMode && stateIds[i].second == states.shader) return i;
+    }
+    if (stateIds.size() > STATE_MASK) return STATE_MASK; // Out of ids: sorts together, still drawn right
+    stateIds.emplace_back(states.blendMode, states.shader);
+    return stateIds.size() - 1;
+}
+
+void RenderQueue::push(RenderLayer layer, Kind kind, const void* object, const sf::Texture* texture,
+                       const sf::RenderStates& states, std::size_t vertexCount, sf::PrimitiveType type) {
+    if (states.texture) texture = states.texture;
+    std::uint64_t key = static_cast<std::uint64_t>(layer) << LAYER_SHIFT |
+                        stateId(states) << STATE_SHIFT |
+                        (texture ? texture->getNativeHandle() & TEXTURE_MASK : 0);
+    commands.push_back({key, static_cast<std::uint32_t>(commands.size()), kind, object, vertexCount, type, states});
+}
+
+void RenderQueue::submit(RenderLayer layer, const sf::Shape& shape, const sf::RenderStates& states) {
+    push(layer, Kind::Shape, &shape, shape.getTexture(), states);
+}
+
+void RenderQueue::submit(RenderLayer layer, const sf::Sprite& sprite, const sf::RenderStates& states) {
+    push(layer, Kind::Sprite, &sprite, &sprite.getTexture(), states);
+}
+
+void RenderQueue::submit(RenderLayer layer, const sf::Text& text, const sf::RenderStates& states) {
+    push(layer, Kind::Text, &text, &text.getFont().getTexture(text.getCharacterSize()), states);
+}
+
+void RenderQueue::submit(RenderLayer layer, const sf::Vertex* vertices, std::size_t count, sf::PrimitiveType type,
+                         const sf::RenderStates& states) {
+    push(layer, Kind::Vertices, vertices, nullptr, states, count, type);
+}
+
+std::uint64_t RenderQueue::countStateChanges() const {
+    std::uint64_t changes = 0;
+    for (std::size_t i = 0; i < commands.size(); ++i) {
+        if (i == 0 || stateOf(commands[i].key) != stateOf(commands[i - 1].key)) ++changes;
+    }
+    return changes;
+}
+
+void RenderQueue::flush(sf::RenderTarget& target) {
+    std::uint64_t unsortedChanges = countStateChanges();
+    std::sort(commands.begin(), commands.end(), [](const Command& a, const Command& b) {
+        return a.key != b.key ? a.key < b.key : a.sequence < b.sequence;
+    });
+    RenderStats::frame.stateChangesSaved += unsortedChanges - countStateChanges();
+
+    for (const Command& command : commands) {
+        switch (command.kind) {
+            case Kind::Shape: drawCounted(target, *static_cast<const sf::Shape*>(command.object), command.states); break;
+            case Kind::Sprite: drawCounted(target, *static_cast<const sf::Sprite*>(command.object), command.states); break;
+            case Kind::Text: drawCounted(target, *static_cast<const sf::Text*>(command.object), command.states); break;
+            case Kind::Vertices:
+                drawCounted(target, static_cast<const sf::Vertex*>(command.object), command.vertexCount,
+                            command.type, command.states);
+                break;
+        }
+    }
+    commands.clear();
+}
+
+std::size_t RenderQueue::size() const { return commands.size(); }
@@ -0,0 +1,66 @@
+#ifndef RENDERQUEUE_H
+#define RENDERQUEUE_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Back to front. Within a layer the queue may reorder freely, so anything
+// that must cover something else goes in a later layer.
+enum class RenderLayer : std::uint8_t {
+    Room,        // Background (or just its outline)
+    RoomOverlay, // The open image fading in
+    Markers,     // Vision cones, doors, items - untextured shapes
+    Guards,
+    Player,
+    HudPanels,
+    HudText
+};
+
+// RenderQueue - the playing scene is submitted here rather than drawn, then
+// flush() sorts it by layer, then blend mode/shader, then texture, and draws
+// it through drawCounted(). Like commands stay in submission order, so equal
+// keys draw exactly as before. The objects must stay alive and unchanged
+// until the flush. Sorting does not allocate; the command array keeps its
+// capacity from frame to frame.
+//
+// State changes (blend/shader or texture differing from the previous draw)
+// are counted in both orders, and the difference goes into
+// RenderStats::frame.stateChangesSaved.
+class RenderQueue {
+private:
+    enum class Kind : std::uint8_t { Shape, Sprite, Text, Vertices };
+
+    struct Command {
+        std::uint64_t key;       // layer | state id | texture handle
+        std::uint32_t sequence;  // Submission order, for ties
+        Kind kind;
+        const void* object;      // The drawable, or the first vertex
+        std::size_t vertexCount;
+        sf::PrimitiveType type;
+        sf::RenderStates states;
+    };
+
+    std::vector<Command> commands;
+    std::vector<std::pair<sf::BlendMode, const sf::Shader*>> stateIds; // Index = id, first come first served
+
+    std::uint64_t stateId(const sf::RenderStates& states);
+    void push(RenderLayer layer, Kind kind, const void* object, const sf::Texture* texture,
+              const sf::RenderStates& states, std::size_t vertexCount = 0,
+              sf::PrimitiveType type = sf::PrimitiveType::Triangles);
+    std::uint64_t countStateChanges() const; // In the current order
+
+public:
+    void submit(RenderLayer layer, const sf::Shape& shape, const sf::RenderStates& states = sf::RenderStates::Default);
+    void submit(RenderLayer layer, const sf::Sprite& sprite, const sf::RenderStates& states = sf::RenderStates::Default);
+    void submit(RenderLayer layer, const sf::Text& text, const sf::RenderStates& states = sf::RenderStates::Default);
+    void submit(RenderLayer layer, const sf::Vertex* vertices, std::size_t count, sf::PrimitiveType type,
+                const sf::RenderStates& states = sf::RenderStates::Default);
+
+    void flush(sf::RenderTarget& target); // Sort, draw and empty the queue
+    std::size_t size() const;
+};
+
+#endif // RENDERQUEUE_H
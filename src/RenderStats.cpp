@@ -0,0 +1,130 @@
+/*
+ * Museum Escape - Render Statistics Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "RenderStats.h"
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+namespace {
+    // One layer of the heatmap, added per draw: red saturates at about 5
+    // layers, then it turns orange and reaches yellow at 16
+    const sf::Color HEAT_LAYER(48, 16, 6);
+
+    const void* const NO_TEXTURE_YET = &HEAT_LAYER; // Never a texture; the first textured draw counts as a bind
+
+    std::vector<sf::Vertex> heatVertices; // Reused between heatmap frames
+
+    bool triangleBased(sf::PrimitiveType type) {
+        return type == sf::PrimitiveType::Triangles || type == sf::PrimitiveType::TriangleStrip ||
+               type == sf::PrimitiveType::TriangleFan;
+    }
+
+    // Every triangle a triangle primitive makes of the vertices, as corner positions
+    template<typename Visit>
+    void forEachTriangle(const sf::Vertex* vertices, std::size_t count, sf::PrimitiveType type, Visit visit) {
+        if (count < 3) return;
+        if (type == sf::PrimitiveType::Triangles) {
+            for (std::size_t i = 0; i + 2 < count; i += 3) visit(vertices[i].position, vertices[i + 1].position, vertices[i + 2].position);
+        } else if (type == sf::PrimitiveType::TriangleStrip) {
+            for (std::size_t i = 0; i + 2 < count; ++i) visit(vertices[i].position, vertices[i + 1].position, vertices[i + 2].position);
+        } else {
+            for (std::size_t i = 1; i + 1 < count; ++i) visit(vertices[0].position, vertices[i].position, vertices[i + 1].position);
+        }
+    }
+
+    sf::FloatRect viewRect(const sf::RenderTarget& target) {
+        const sf::View& view = target.getView();
+        return {view.getCenter() - view.getSize() / 2.0f, view.getSize()};
+    }
+}
+
+namespace RenderStats {
+
+void reset() {
+    frame = Counters();
+    lastTexture = NO_TEXTURE_YET;
+    coverage.clear();
+}
+
+bool submit(const sf::RenderTarget& target, const sf::FloatRect& bounds, std::size_t vertexCount,
+            const sf::Texture* texture, bool visible,
+            const sf::Vertex* geometry, sf::PrimitiveType type, const sf::Transform& transform) {
+    std::optional<sf::FloatRect> onScreen = viewRect(target).findIntersection(bounds);
+    if (!visible || !onScreen) {
+        ++frame.culled;
+        return false;
+    }
+
+    ++frame.drawCalls;
+    frame.vertices += vertexCount;
+    if (texture && texture != lastTexture) ++frame.textureBinds;
+    lastTexture = texture;
+
+    // Covered area in view units: the clipped bounds, or for triangles their
+    // own area (unclipped, so capped at the bounds')
+    bool keepCoverage = &target == heatmapTarget;
+    double area = static_cast<double>(onScreen->size.x) * onScreen->size.y;
+    if (geometry && triangleBased(type)) {
+        double triangles = 0.0;
+        forEachTriangle(geometry, vertexCount, type, [&](sf::Vector2f a, sf::Vector2f b, sf::Vector2f c) {
+            a = transform.transformPoint(a);
+            b = transform.transformPoint(b);
+            c = transform.transformPoint(c);
+            triangles += std::abs(static_cast<double>((b - a).cross(c - a))) / 2.0;
+            if (keepCoverage) coverage.insert(coverage.end(), {a, b, c});
+        });
+        area = std::min(area, triangles);
+    } else if (keepCoverage) {
+        const sf::FloatRect& rect = *onScreen;
+        sf::Vector2f topRight = rect.position + sf::Vector2f(rect.size.x, 0.0f);
+        sf::Vector2f bottomLeft = rect.position + sf::Vector2f(0.0f, rect.size.y);
+        coverage.insert(coverage.end(), {rect.position, topRight, rect.position + rect.size,
+                                         rect.position, rect.position + rect.size, bottomLeft});
+    }
+    
+    // View units to pixels (the views here are never rotated)
+    double scale = static_cast<double>(target.getSize().x) / target.getView().getSize().x *
+                   target.getSize().y / target.getView().getSize().y;
+    frame.coveredPixels += area * scale;
+    return true;
+}
+
+double overdraw(const sf::RenderTarget& target) {
+    double screen = static_cast<double>(target.getSize().x) * target.getSize().y;
+    return screen > 0.0 ? frame.coveredPixels / screen : 0.0;
+}
+
+// Drawn straight to the target, so the heatmap is not in its own numbers
+void drawHeatmap(sf::RenderTarget& target) {
+    heatVertices.resize(coverage.size());
+    for (std::size_t i = 0; i < coverage.size(); ++i) heatVertices[i] = sf::Vertex{coverage[i], HEAT_LAYER};
+    if (!heatVertices.empty()) {
+        target.draw(heatVertices.data(), heatVertices.size(), sf::PrimitiveType::Triangles, sf::BlendAdd);
+    }
+}
+
+std::size_t textVertexCount(const sf::Text& text) {
+    std::size_t glyphs = 0;
+    for (char32_t character : text.getString()) {
+        if (character != U' ' && character != U'\n' && character != U'\t') ++glyphs;
+    }
+    return glyphs * 6;
+}
+
+sf::FloatRect vertexBounds(const sf::Vertex* vertices, std::size_t count) {
+    if (count == 0) return {};
+    sf::Vector2f low = vertices[0].position;
+    sf::Vector2f high = low;
+    for (std::size_t i = 1; i < count; ++i) {
+        low.x = std::min(low.x, vertices[i].position.x);
+        low.y = std::min(low.y, vertices[i].position.y);
+        high.x = std::max(high.x, vertices[i].position.x);
+        high.y = std::max(high.y, vertices[i].position.y);
+    }
+    return {low, high - low};
+}
+
+} // namespace RenderStats
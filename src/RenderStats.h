@@ -0,0 +1,102 @@
+#ifndef RENDERSTATS_H
+#define RENDERSTATS_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// RenderStats - what the game asks the GPU for. Every draw goes through
+// drawCounted(), which counts draw calls, vertices, texture changes and an
+// estimate of the pixels covered (shapes, sprites and text by their bounds,
+// vertex draws by their triangles), and culls draws that cannot show: fully
+// transparent ones and ones outside the view. Counters are plain integers
+// because drawing only ever happens on the main thread; the game resets them
+// at the start of every render().
+//
+// With a heatmap target set, the covered area of each draw to that target is
+// kept as triangles too, and drawHeatmap() paints them additively - brighter
+// is more layers of overdraw.
+namespace RenderStats {
+    struct Counters {
+        std::uint64_t drawCalls = 0;
+        std::uint64_t vertices = 0;
+        std::uint64_t textureBinds = 0;  // Draws whose texture differs from the previous draw's
+        std::uint64_t culled = 0;        // Draws skipped as invisible or off-screen
+        std::uint64_t stateChangesSaved = 0; // By RenderQueue sorting, against submission order
+        double coveredPixels = 0.0;      // Sum of the drawn areas, clipped to the view
+    };
+
+    inline Counters frame;                            // Since the last reset()
+    inline const void* lastTexture = nullptr;
+    inline const sf::RenderTarget* heatmapTarget = nullptr; // nullptr = no coverage kept
+    inline std::vector<sf::Vector2f> coverage;        // Triangle corners of this frame's draws to heatmapTarget
+
+    void reset();
+
+    // Counts a draw about to be issued; false when it is culled instead. With
+    // geometry (moved by transform) its triangles give the covered area.
+    bool submit(const sf::RenderTarget& target, const sf::FloatRect& bounds, std::size_t vertexCount,
+                const sf::Texture* texture, bool visible,
+                const sf::Vertex* geometry = nullptr, sf::PrimitiveType type = sf::PrimitiveType::Triangles,
+                const sf::Transform& transform = sf::Transform::Identity);
+
+    // Estimated overdraw: covered pixels per pixel of the target
+    double overdraw(const sf::RenderTarget& target);
+
+    void drawHeatmap(sf::RenderTarget& target);
+
+    std::size_t textVertexCount(const sf::Text& text);
+    sf::FloatRect vertexBounds(const sf::Vertex* vertices, std::size_t count);
+}
+
+// Drawables whose size is unknown are counted but never culled
+inline void drawCounted(sf::RenderTarget& target, const sf::Drawable& drawable,
+                        const sf::RenderStates& states = sf::RenderStates::Default) {
+    ++RenderStats::frame.drawCalls;
+    target.draw(drawable, states);
+}
+
+inline void drawCounted(sf::RenderTarget& target, const sf::Shape& shape,
+                        const sf::RenderStates& states = sf::RenderStates::Default) {
+    bool outlined = shape.getOutlineThickness() != 0.0f && shape.getOutlineColor().a > 0;
+    std::size_t points = shape.getPointCount();
+    std::size_t vertices = points + 2 + (outlined ? (points + 1) * 2 : 0);
+    const sf::Texture* texture = states.texture ? states.texture : shape.getTexture();
+    if (RenderStats::submit(target, states.transform.transformRect(shape.getGlobalBounds()), vertices, texture,
+                            shape.getFillColor().a > 0 || outlined)) {
+        target.draw(shape, states);
+    }
+}
+
+inline void drawCounted(sf::RenderTarget& target, const sf::Sprite& sprite,
+                        const sf::RenderStates& states = sf::RenderStates::Default) {
+    if (RenderStats::submit(target, states.transform.transformRect(sprite.getGlobalBounds()), 4,
+                            &sprite.getTexture(), sprite.getColor().a > 0)) {
+        target.draw(sprite, states);
+    }
+}
+
+inline void drawCounted(sf::RenderTarget& target, const sf::Text& text,
+                        const sf::RenderStates& states = sf::RenderStates::Default) {
+    bool outlined = text.getOutlineThickness() != 0.0f && text.getOutlineColor().a > 0;
+    std::size_t vertices = RenderStats::textVertexCount(text);
+    if (outlined) vertices *= 2;
+    if (RenderStats::submit(target, states.transform.transformRect(text.getGlobalBounds()), vertices,
+                            &text.getFont().getTexture(text.getCharacterSize()),
+                            vertices > 0 && (text.getFillColor().a > 0 || outlined))) {
+        target.draw(text, states);
+    }
+}
+
+inline void drawCounted(sf::RenderTarget& target, const sf::Vertex* vertices, std::size_t count,
+                        sf::PrimitiveType type, const sf::RenderStates& states = sf::RenderStates::Default) {
+    bool visible = false;
+    for (std::size_t i = 0; i < count && !visible; ++i) visible = vertices[i].color.a > 0;
+    if (RenderStats::submit(target, states.transform.transformRect(RenderStats::vertexBounds(vertices, count)),
+                            count, states.texture, visible, vertices, type, states.transform)) {
+        target.draw(vertices, count, type, states);
+    }
+}
+
+#endif // RENDERSTATS_H
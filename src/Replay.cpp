@@ -0,0 +1,231 @@
+/*
+ * Museum Escape - Input Replay Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "Replay.h"
+#include <fstream>
+#include <sstream>
+
+namespace {
+    struct KeyName {
+        const char* name;
+        sf::Keyboard::Key key;
+    };
+
+    // Every key the game or a puzzle reacts to
+    const KeyName KEY_NAMES[] = {
+        {"Enter", sf::Keyboard::Key::Enter},
+        {"Escape", sf::Keyboard::Key::Escape},
+        {"E", sf::Keyboard::Key::E},
+        {"P", sf::Keyboard::Key::P},
+        {"I", sf::Keyboard::Key::I},
+        {"H", sf::Keyboard::Key::H},
+        {"R", sf::Keyboard::Key::R},
+        {"Backspace", sf::Keyboard::Key::Backspace},
+    };
+
+    const char* HOLD_NAMES[] = { "up", "down", "left", "right" }; // Bit i of the mask
+
+    bool isPrintable(char32_t character) { return character > 32 && character < 127; }
+}
+
+Replay::Replay() : cursor(0), held(MOVE_NONE), recordedHeld(MOVE_NONE) {}
+
+bool Replay::loadFromFile(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    if (!in) {
+        error = "cannot open " + path;
+        return false;
+    }
+    std::ostringstream text;
+    text << in.rdbuf();
+    return loadFromText(text.str());
+}
+
+bool Replay::loadFromText(const std::string& text) {
+    inputs.clear();
+    error.clear();
+    std::istringstream lines(text);
+    std::string line;
+    int lineNumber = 0;
+    std::uint32_t lastFrame = 0;
+
+    while (std::getline(lines, line)) {
+        ++lineNumber;
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        std::istringstream fields(line);
+        std::string first;
+        if (!(fields >> first) || first[0] == '#') continue;
+
+        Input input{};
+        std::string type;
+        std::istringstream frameField(first);
+        if (!(frameField >> input.frame) || !(fields >> type) || input.frame < lastFrame) {
+            error = "line " + std::to_string(lineNumber) + ": expected <frame> <input>, frames in order";
+            return false;
+        }
+        lastFrame = input.frame;
+
+        if (type == "hold") {
+            input.type = InputType::Hold;
+            std::string name;
+            while (fields >> name) {
+                bool known = false;
+                for (unsigned bit = 0; bit < 4; ++bit) {
+                    if (name == HOLD_NAMES[bit]) { input.held |= 1u << bit; known = true; }
+                }
+                if (!known && name != "none") {
+                    error = "line " + std::to_string(lineNumber) + ": unknown direction '" + name + "'";
+                    return false;
+                }
+            }
+            inputs.push_back(input);
+        } else if (type == "key") {
+            input.type = InputType::Key;
+            std::string name;
+            fields >> name;
+            bool known = false;
+            for (const KeyName& entry : KEY_NAMES) {
+                if (name == entry.name) { input.key = entry.key; known = true; }
+            }
+            if (!known) {
+                error = "line " + std::to_string(lineNumber) + ": unknown key '" + name + "'";
+                return false;
+            }
+            inputs.push_back(input);
+        } else if (type == "text" || type == "char") {
+            input.type = InputType::Text;
+            std::string characters;
+            if (type == "char") {
+                unsigned code = 0;
+                if (!(fields >> code)) {
+                    error = "line " + std::to_string(lineNumber) + ": expected a character code";
+                    return false;
+                }
+                characters.push_back(static_cast<char>(code));
+            } else {
+                fields >> characters;
+            }
+            for (char character : characters) {
+                input.character = static_cast<unsigned char>(character);
+                inputs.push_back(input);
+            }
+        } else if (type == "click") {
+            input.type = InputType::Click;
+            if (!(fields >> input.position.x >> input.position.y)) {
+                error = "line " + std::to_string(lineNumber) + ": expected click <x> <y>";
+                return false;
+            }
+            inputs.push_back(input);
+        } else {
+            error = "line " + std::to_string(lineNumber) + ": unknown input '" + type + "'";
+            return false;
+        }
+    }
+    rewind();
+    return true;
+}
+
+bool Replay::saveToFile(const std::string& path) const {
+    std::ofstream out(path, std::ios::binary);
+    out << "# Museum Escape replay - <frame> hold|key|text|char|click ...\n";
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+        const Input& input = inputs[i];
+        out << input.frame << ' ';
+        switch (input.type) {
+            case InputType::Hold:
+                out << "hold";
+                if (input.held == MOVE_NONE) out << " none";
+                for (unsigned bit = 0; bit < 4; ++bit) {
+                    if (input.held & (1u << bit)) out << ' ' << HOLD_NAMES[bit];
+                }
+                break;
+            case InputType::Key:
+                out << "key";
+                for (const KeyName& entry : KEY_NAMES) {
+                    if (entry.key == input.key) out << ' ' << entry.name;
+                }
+                break;
+            case InputType::Text:
+                if (!isPrintable(input.character)) {
+                    out << "char " << static_cast<unsigned>(input.character);
+                    break;
+                }
+                // Printable characters typed in the same frame share a line
+                out << "text " << static_cast<char>(input.character);
+                while (i + 1 < inputs.size() && inputs[i + 1].frame == input.frame &&
+                       inputs[i + 1].type == InputType::Text && isPrintable(inputs[i + 1].character)) {
+                    out << static_cast<char>(inputs[++i].character);
+                }
+                break;
+            case InputType::Click:
+                out << "click " << input.position.x << ' ' << input.position.y;
+                break;
+        }
+        out << '\n';
+    }
+    return static_cast<bool>(out);
+}
+
+const std::string& Replay::getError() const { return error; }
+
+void Replay::recordEvent(std::uint32_t frame, const sf::Event& event) {
+    Input input{};
+    input.frame = frame;
+    if (const auto* keyPressed = event.getIf<sf::Event::KeyPressed>()) {
+        for (const KeyName& entry : KEY_NAMES) {
+            if (entry.key != keyPressed->code) continue;
+            input.type = InputType::Key;
+            input.key = entry.key;
+            inputs.push_back(input);
+        }
+    } else if (const auto* textEntered = event.getIf<sf::Event::TextEntered>()) {
+        if (textEntered->unicode < 128) {
+            input.type = InputType::Text;
+            input.character = textEntered->unicode;
+            inputs.push_back(input);
+        }
+    } else if (const auto* mousePressed = event.getIf<sf::Event::MouseButtonPressed>()) {
+        if (mousePressed->button == sf::Mouse::Button::Left) {
+            input.type = InputType::Click;
+            input.position = mousePressed->position;
+            inputs.push_back(input);
+        }
+    }
+}
+
+void Replay::recordHeld(std::uint32_t frame, unsigned mask) {
+    if (mask == recordedHeld) return;
+    recordedHeld = mask;
+    Input input{};
+    input.frame = frame;
+    input.type = InputType::Hold;
+    input.held = mask;
+    inputs.push_back(input);
+}
+
+void Replay::rewind() {
+    cursor = 0;
+    held = MOVE_NONE;
+}
+
+void Replay::eventsForFrame(std::uint32_t frame, std::vector<sf::Event>& out) {
+    while (cursor < inputs.size() && inputs[cursor].frame <= frame) {
+        const Input& input = inputs[cursor++];
+        switch (input.type) {
+            case InputType::Hold: held = input.held; break;
+            case InputType::Key: out.push_back(sf::Event::KeyPressed{input.key}); break;
+            case InputType::Text: out.push_back(sf::Event::TextEntered{input.character}); break;
+            case InputType::Click:
+                out.push_back(sf::Event::MouseButtonPressed{sf::Mouse::Button::Left, input.position});
+                break;
+        }
+    }
+}
+
+unsigned Replay::getHeld() const { return held; }
+
+std::uint32_t Replay::getLastFrame() const { return inputs.empty() ? 0 : inputs.back().frame; }
+
+bool Replay::isFinished() const { return cursor >= inputs.size(); }
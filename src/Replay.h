@@ -0,0 +1,69 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <SFML/Window/Event.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Movement keys held, as a bit mask (Player::handleInput)
+enum MoveKeys : unsigned {
+    MOVE_NONE = 0,
+    MOVE_UP = 1,
+    MOVE_DOWN = 2,
+    MOVE_LEFT = 4,
+    MOVE_RIGHT = 8
+};
+
+// Replay - a played session as frame-stamped input, so the same game can be
+// run again at a fixed step (game.exe --record / --bench). Text format, one
+// input per line, frames in increasing order:
+//
+//   <frame> hold [up] [down] [left] [right]   movement keys held from this frame on
+//   <frame> key <Enter|Escape|E|P|I|H|R|Backspace>
+//   <frame> text <characters>                 one TextEntered per character
+//   <frame> char <code>                       one TextEntered by code (8 = backspace)
+//   <frame> click <x> <y>                     left mouse button
+//
+// Only inputs the game reacts to are stored; anything else is dropped when
+// recording.
+class Replay {
+private:
+    enum class InputType { Hold, Key, Text, Click };
+
+    struct Input {
+        std::uint32_t frame;
+        InputType type;
+        unsigned held;            // Hold
+        sf::Keyboard::Key key;    // Key
+        char32_t character;       // Text
+        sf::Vector2i position;    // Click
+    };
+
+    std::vector<Input> inputs;
+    std::size_t cursor;           // Next input to play
+    unsigned held;                // Movement keys held at the last played frame
+    unsigned recordedHeld;        // Last mask written by recordHeld
+    std::string error;
+
+public:
+    Replay();
+
+    bool loadFromFile(const std::string& path);
+    bool loadFromText(const std::string& text);
+    bool saveToFile(const std::string& path) const;
+    const std::string& getError() const;
+
+    // Recording - frames must not go backwards
+    void recordEvent(std::uint32_t frame, const sf::Event& event);
+    void recordHeld(std::uint32_t frame, unsigned mask); // Stored only when it changes
+
+    // Playback
+    void rewind();
+    void eventsForFrame(std::uint32_t frame, std::vector<sf::Event>& out); // Appends; also advances the held mask
+    unsigned getHeld() const;
+    std::uint32_t getLastFrame() const;
+    bool isFinished() const;
+};
+
+#endif // REPLAY_H
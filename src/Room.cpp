@@ -8,15 +8,24 @@
 #include "Item.h"
 #include "Guard.h"
 #include <cstdint> // <--- ADDED: Required for std::uint8_t
+#include <algorithm>
+#include <utility>
+
+namespace {
+    const float FADE_SECONDS = 255.0f / 200.0f; // Solved background, 200 alpha a second
+    const sf::Color SOLVED_HIDDEN(255, 255, 255, 0);
+}
 
 Room::Room(int id, const std::string& name, float x, float y, float width, float height)
     : roomID(id),
       roomName(name),
       position(x, y),
       size(width, height),
-      hasSolvedTexture(false),
-      isTransitioning(false),
-      transitionAlpha(0.0f),
+      solvedTexture(nullptr),
+      solvedOpaque(false),
+      tweens(nullptr),
+      unsolvedPuzzleCount(0),
+      collisionMap(x, y, width, height),
       isExitRoom(false),
       isVisited(false)
 {
@@ -26,11 +35,22 @@ Room::Room(int id, const std::string& name, float x, float y, float width, float
     background.setFillColor(sf::Color(40, 40, 50)); 
     background.setOutlineThickness(2.0f);
     background.setOutlineColor(sf::Color::White);
+    
+    // The same outline as a strip: inner and outer corner, round and back to the start
+    float thickness = background.getOutlineThickness();
+    sf::Vector2f inner[4] = {position, position + sf::Vector2f(width, 0.0f), position + size, position + sf::Vector2f(0.0f, height)};
+    sf::Vector2f outward[4] = {{-thickness, -thickness}, {thickness, -thickness}, {thickness, thickness}, {-thickness, thickness}};
+    for (std::size_t i = 0; i < 5; ++i) {
+        backgroundOutline[i * 2] = sf::Vertex{inner[i % 4], background.getOutlineColor()};
+        backgroundOutline[i * 2 + 1] = sf::Vertex{inner[i % 4] + outward[i % 4], background.getOutlineColor()};
+    }
 
     // Solved Background - Start INVISIBLE
-    solvedBackground.setSize({width, height});
-    solvedBackground.setPosition(position);
-    solvedBackground.setFillColor(sf::Color(255, 255, 255, 0)); // Alpha = 0
+    solvedBackground[0].position = position;
+    solvedBackground[1].position = position + sf::Vector2f(width, 0.0f);
+    solvedBackground[2].position = position + sf::Vector2f(0.0f, height);
+    solvedBackground[3].position = position + sf::Vector2f(width, height);
+    for (sf::Vertex& vertex : solvedBackground) vertex.color = SOLVED_HIDDEN;
 }
 
 void Room::setBackgroundTexture(const sf::Texture& texture) {
@@ -39,90 +59,118 @@ void Room::setBackgroundTexture(const sf::Texture& texture) {
 }
 
 // Ensure it starts transparent
-void Room::setSolvedBackgroundTexture(const sf::Texture& texture) {
-    solvedBackground.setTexture(&texture);
-    hasSolvedTexture = true;
+void Room::setSolvedBackgroundTexture(const sf::Texture& texture, bool opaque) {
+    solvedTexture = &texture;
+    solvedOpaque = opaque;
+    sf::Vector2f textureSize(texture.getSize());
+    solvedBackground[0].texCoords = {0.0f, 0.0f};
+    solvedBackground[1].texCoords = {textureSize.x, 0.0f};
+    solvedBackground[2].texCoords = {0.0f, textureSize.y};
+    solvedBackground[3].texCoords = textureSize;
     
     // Force it to be invisible initially!
-    solvedBackground.setFillColor(sf::Color(255, 255, 255, 0));
-    transitionAlpha = 0.0f;
+    if (tweens) tweens->stop(solvedBackground.data());
+    for (sf::Vertex& vertex : solvedBackground) vertex.color = SOLVED_HIDDEN;
 }
 
-// Start smooth fade-in
+// Start smooth fade-in, from wherever the alpha is now
 void Room::revealSolvedBackground() {
-    if (hasSolvedTexture && transitionAlpha < 255.0f) {
-        isTransitioning = true;
+    if (!solvedTexture || solvedBackground[0].color.a == 255) return;
+    if (!tweens) {
+        forceSolvedBackground();
+        return;
     }
+    if (tweens->isAnimating(solvedBackground.data())) return;
+    sf::Color from = solvedBackground[0].color;
+    tweens->tweenColor(solvedBackground.data(), solvedBackground.size(), from, sf::Color::White,
+                       FADE_SECONDS * (255 - from.a) / 255.0f);
 }
 
 // Instant show (for re-entering solved rooms)
 void Room::forceSolvedBackground() {
-    if (hasSolvedTexture) {
-        transitionAlpha = 255.0f;
-        solvedBackground.setFillColor(sf::Color(255, 255, 255, 255));
-        isTransitioning = false;
+    if (solvedTexture) {
+        if (tweens) tweens->stop(solvedBackground.data());
+        for (sf::Vertex& vertex : solvedBackground) vertex.color = sf::Color::White;
     }
 }
 
+void Room::setTweenSystem(TweenSystem* system) { tweens = system; }
+
 void Room::update(float deltaTime) {
-    // Handle fade-in transition
-    if (isTransitioning) {
-        transitionAlpha += deltaTime * 200.0f; // Speed of fade
-        
-        if (transitionAlpha >= 255.0f) {
-            transitionAlpha = 255.0f;
-            isTransitioning = false;
+    // Update unsolved puzzles; a solved one is swapped behind the unsolved range
+    for (std::size_t i = 0; i < unsolvedPuzzleCount;) {
+        PuzzleVariant& puzzle = *puzzles[i];
+        if (puzzleBase(puzzle).isSolvedStatus()) {
+            std::swap(puzzles[i], puzzles[--unsolvedPuzzleCount]);
+            continue;
         }
-        
-        // Update alpha
-        // FIXED: Replaced sf::Uint8 with std::uint8_t
-        solvedBackground.setFillColor(sf::Color(255, 255, 255, static_cast<std::uint8_t>(transitionAlpha)));
-    }
-
-    // Update puzzles
-    for (auto& puzzle : puzzles) {
-        puzzle->update(deltaTime);
+        std::visit([deltaTime](auto& p) { p.update(deltaTime); }, puzzle);
+        ++i;
     }
 }
 
-void Room::draw(sf::RenderWindow& window) {
-    // 1. Always draw normal background at bottom
-    window.draw(background);
+void Room::draw(RenderQueue& queue) {
+    // 1. Normal background at bottom - just its outline once an opaque open image covers it
+    if (solvedTexture && solvedOpaque && solvedBackground[0].color.a == 255) {
+        queue.submit(RenderLayer::Room, backgroundOutline.data(), backgroundOutline.size(), sf::PrimitiveType::TriangleStrip);
+    } else {
+        queue.submit(RenderLayer::Room, background);
+    }
     
     // 2. Draw solved background on top (only if partially/fully visible)
-    if (hasSolvedTexture && transitionAlpha > 0.0f) {
-        window.draw(solvedBackground);
+    if (solvedTexture && solvedBackground[0].color.a > 0) {
+        sf::RenderStates states;
+        states.texture = solvedTexture;
+        queue.submit(RenderLayer::RoomOverlay, solvedBackground.data(), solvedBackground.size(),
+                     sf::PrimitiveType::TriangleStrip, states);
     }
     
-    // Draw entities
-    for (auto& guard : guards) guard->draw(window, true);
-    for (auto& door : doors) door->draw(window);
+    // Entities - the queue groups the cones, doors and items, then the guard sprites
+    visionOverlay.clear();
+    for (auto& guard : guards) {
+        visionOverlay.add(guard->getVisionCone());
+        guard->draw(queue);
+    }
+    visionOverlay.draw(queue);
+    for (auto& door : doors) door->draw(queue);
     for (auto& item : items) {
-        if (!item->isItemCollected()) item->draw(window);
+        if (!item->isItemCollected()) item->draw(queue);
     }
 }
 
 // ... (Rest of Room methods) ...
 
-void Room::addPuzzle(std::shared_ptr<Puzzle> puzzle) { puzzles.push_back(puzzle); }
-std::vector<std::shared_ptr<Puzzle>>& Room::getPuzzles() { return puzzles; }
+CollisionMap& Room::getCollisionMap() { return collisionMap; }
+const CollisionMap& Room::getCollisionMap() const { return collisionMap; }
+
+void Room::addPuzzle(PuzzleVariant* puzzle) {
+    // Keep the unsolved range at the front
+    puzzles.push_back(puzzle);
+    if (!puzzleBase(*puzzle).isSolvedStatus()) {
+        std::swap(puzzles.back(), puzzles[unsolvedPuzzleCount++]);
+    }
+}
+std::vector<PuzzleVariant*>& Room::getPuzzles() { return puzzles; }
 bool Room::allPuzzlesSolved() const {
-    for (const auto& puzzle : puzzles) {
-        if (!puzzle->isSolvedStatus()) return false;
+    for (std::size_t i = 0; i < unsolvedPuzzleCount; ++i) {
+        if (!puzzleBase(*puzzles[i]).isSolvedStatus()) return false;
     }
     return true;
 }
-void Room::addItem(std::shared_ptr<Item> item) { items.push_back(item); }
-void Room::removeItem(std::shared_ptr<Item> item) {
+void Room::addItem(Item* item) { items.push_back(item); }
+void Room::removeItem(Item* item) {
     for (auto it = items.begin(); it != items.end(); ++it) {
         if (*it == item) { items.erase(it); return; }
     }
 }
-std::vector<std::shared_ptr<Item>>& Room::getItems() { return items; }
-void Room::addGuard(std::shared_ptr<Guard> guard) { guards.push_back(guard); }
-std::vector<std::shared_ptr<Guard>>& Room::getGuards() { return guards; }
-void Room::addDoor(std::shared_ptr<Door> door) { doors.push_back(door); }
-std::vector<std::shared_ptr<Door>>& Room::getDoors() { return doors; }
+std::vector<Item*>& Room::getItems() { return items; }
+void Room::addGuard(Guard* guard) { guards.push_back(guard); }
+void Room::removeGuard(Guard* guard) {
+    guards.erase(std::remove(guards.begin(), guards.end(), guard), guards.end());
+}
+std::vector<Guard*>& Room::getGuards() { return guards; }
+void Room::addDoor(Door* door) { doors.push_back(door); }
+std::vector<Door*>& Room::getDoors() { return doors; }
 int Room::getRoomID() const { return roomID; }
 std::string Room::getRoomName() const { return roomName; }
 sf::Vector2f Room::getPosition() const { return position; }
@@ -136,19 +184,21 @@ bool Room::containsPoint(const sf::Vector2f& point) const { return background.ge
 
 // === DOOR IMPLEMENTATION ===
 Door::Door(float x, float y, int targetRoom, bool locked, const std::string& keyName)
-    : position(x, y), targetRoomID(targetRoom), isLocked(locked), requiredKey(keyName) {
+    : position(x, y), targetRoomID(targetRoom), isLocked(locked), requiredKeyID(internItemID(keyName)) {
     sprite.setSize({50.0f, 100.0f});
     sprite.setPosition(position);
     sprite.setFillColor(sf::Color::Transparent); // Invisible door
 }
 void Door::unlock() { isLocked = false; }
-bool Door::canOpen(const std::string& keyName) {
+bool Door::canOpen(ItemID keyID) {
     if (!isLocked) return true;
-    if (keyName == requiredKey || requiredKey.empty()) { unlock(); return true; }
+    if (keyID == requiredKeyID || requiredKeyID == INVALID_ITEM_ID) { unlock(); return true; }
     return false;
 }
+bool Door::canOpen(const std::string& keyName) { return canOpen(hashItemID(keyName)); }
+ItemID Door::getRequiredKeyID() const { return requiredKeyID; }
 bool Door::checkCollision(const sf::FloatRect& bounds) { return sprite.getGlobalBounds().findIntersection(bounds).has_value(); }
 int Door::getTargetRoomID() const { return targetRoomID; }
 bool Door::getLockedStatus() const { return isLocked; }
 sf::FloatRect Door::getBounds() const { return sprite.getGlobalBounds(); }
-void Door::draw(sf::RenderWindow& window) { window.draw(sprite); }
\ No newline at end of file
+void Door::draw(RenderQueue& queue) { queue.submit(RenderLayer::Markers, sprite); }
\ No newline at end of file
@@ -2,11 +2,16 @@
 #define ROOM_H
 
 #include <SFML/Graphics.hpp>
+#include <array>
 #include <vector>
 #include <string>
-#include <memory>
+#include "ItemID.h"
+#include "Puzzle.h"
+#include "CollisionMap.h"
+#include "Tween.h"
+#include "RenderQueue.h"
+#include "VisionOverlay.h"
 
-class Puzzle;
 class Item;
 class Guard;
 class Door;
@@ -20,17 +25,22 @@ private:
     
     // === BACKGROUNDS ===
     sf::RectangleShape background;       // Normal (Closed)
-    sf::RectangleShape solvedBackground; // Solved (Open)
-    
-    // Transition Logic
-    bool hasSolvedTexture;
-    bool isTransitioning;
-    float transitionAlpha; // 0.0f (Invisible) to 255.0f (Fully Visible)
-    
-    std::vector<std::shared_ptr<Puzzle>> puzzles;
-    std::vector<std::shared_ptr<Item>> items;
-    std::vector<std::shared_ptr<Guard>> guards;
-    std::vector<std::shared_ptr<Door>> doors;
+    std::array<sf::Vertex, 10> backgroundOutline; // Its outline alone, for when the open image hides the rest
+    std::array<sf::Vertex, 4> solvedBackground; // Solved (Open) - a strip whose alpha the tween fades in
+    const sf::Texture* solvedTexture; // nullptr = none
+    bool solvedOpaque; // No transparent pixels - once faded in, nothing under it shows
+    TweenSystem* tweens; // nullptr = reveal instantly
+    
+    // Non-owning - entities live in the Game's LevelArena, puzzles in Game::puzzles.
+    // puzzles[0, unsolvedPuzzleCount) are the unsolved ones, the only ones updated.
+    std::vector<PuzzleVariant*> puzzles;
+    std::size_t unsolvedPuzzleCount;
+    std::vector<Item*> items;
+    std::vector<Guard*> guards;
+    std::vector<Door*> doors;
+    VisionOverlay visionOverlay; // All the guards' cones, one draw
+    
+    CollisionMap collisionMap; // Room edges + walls from the level data
     
     bool isExitRoom;
     bool isVisited;
@@ -41,23 +51,28 @@ public:
     void setBackgroundTexture(const sf::Texture& texture);
     
     // === NEW METHODS ===
-    void setSolvedBackgroundTexture(const sf::Texture& texture); // Load the open image
+    void setSolvedBackgroundTexture(const sf::Texture& texture, bool opaque = false); // Load the open image
     void revealSolvedBackground(); // Start the fade-in effect
     void forceSolvedBackground();  // Show immediately (for when re-entering room)
+    void setTweenSystem(TweenSystem* system);
 
-    void addPuzzle(std::shared_ptr<Puzzle> puzzle);
-    std::vector<std::shared_ptr<Puzzle>>& getPuzzles();
+    CollisionMap& getCollisionMap();
+    const CollisionMap& getCollisionMap() const;
+    
+    void addPuzzle(PuzzleVariant* puzzle);
+    std::vector<PuzzleVariant*>& getPuzzles();
     bool allPuzzlesSolved() const;
     
-    void addItem(std::shared_ptr<Item> item);
-    void removeItem(std::shared_ptr<Item> item);
-    std::vector<std::shared_ptr<Item>>& getItems();
+    void addItem(Item* item);
+    void removeItem(Item* item);
+    std::vector<Item*>& getItems();
     
-    void addGuard(std::shared_ptr<Guard> guard);
-    std::vector<std::shared_ptr<Guard>>& getGuards();
+    void addGuard(Guard* guard);
+    void removeGuard(Guard* guard);
+    std::vector<Guard*>& getGuards();
     
-    void addDoor(std::shared_ptr<Door> door);
-    std::vector<std::shared_ptr<Door>>& getDoors();
+    void addDoor(Door* door);
+    std::vector<Door*>& getDoors();
     
     int getRoomID() const;
     std::string getRoomName() const;
@@ -72,7 +87,7 @@ public:
     bool hasBeenVisited() const;
     
     void update(float deltaTime);
-    void draw(sf::RenderWindow& window);
+    void draw(RenderQueue& queue);
     
     bool containsPoint(const sf::Vector2f& point) const;
 };
@@ -84,20 +99,22 @@ private:
     sf::RectangleShape sprite;
     int targetRoomID;
     bool isLocked;
-    std::string requiredKey;
+    ItemID requiredKeyID; // Interned key name (INVALID_ITEM_ID = any key)
     
 public:
     Door(float x, float y, int targetRoom, bool locked = false, const std::string& keyName = "");
     
     void unlock();
+    bool canOpen(ItemID keyID);
     bool canOpen(const std::string& keyName);
+    ItemID getRequiredKeyID() const;
     bool checkCollision(const sf::FloatRect& bounds);
     
     int getTargetRoomID() const;
     bool getLockedStatus() const;
     sf::FloatRect getBounds() const;
     
-    void draw(sf::RenderWindow& window);
+    void draw(RenderQueue& queue);
 };
 
 #endif // ROOM_H
\ No newline at end of file
@@ -0,0 +1,184 @@
+/*
+ * Museum Escape - Cross-Room Router Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "RoomRouter.h"
+#include "RoomTable.h"
+#include "Room.h"
+#include "Item.h"
+#include "Pathfinding.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+
+namespace {
+    const float NO_ROUTE = std::numeric_limits<float>::infinity();
+
+    // Straight-line walking estimate on an 8-connected grid
+    float octileDistance(const sf::Vector2f& a, const sf::Vector2f& b) {
+        float dx = std::abs(a.x - b.x);
+        float dy = std::abs(a.y - b.y);
+        return std::max(dx, dy) + 0.41421356f * std::min(dx, dy);
+    }
+
+    sf::Vector2f centerOf(const sf::FloatRect& rect) {
+        return rect.position + rect.size / 2.0f;
+    }
+}
+
+RoomRouter::RoomRouter() : rooms(nullptr) {}
+
+void RoomRouter::build(const RoomTable& table) {
+    clear();
+    rooms = &table;
+    std::size_t roomCount = table.size();
+    portalStart.assign(roomCount + 1, 0);
+    costStart.assign(roomCount + 1, 0);
+    if (roomCount == 0) return;
+
+    // Portals mirror the RoomTable's CSR edge list
+    for (std::size_t slot = 0; slot < roomCount; ++slot) {
+        portalStart[slot] = portals.size();
+        for (const RoomEdge* edge = table.edgesBegin(static_cast<int>(slot)); edge != table.edgesEnd(static_cast<int>(slot)); ++edge) {
+            Portal portal;
+            portal.slot = static_cast<int>(slot);
+            portal.targetSlot = edge->toSlot;
+            portal.door = edge->door;
+            portal.point = centerOf(edge->door->getBounds());
+            portal.arrival = -1;
+            portals.push_back(portal);
+        }
+    }
+    portalStart[roomCount] = portals.size();
+
+    // Going through a door puts you at the door that leads back
+    for (Portal& portal : portals) {
+        Room* target = table.at(portal.targetSlot);
+        portal.arrivalPoint = target->getPosition() + target->getSize() / 2.0f;
+        for (std::size_t q = portalStart[portal.targetSlot]; q < portalStart[portal.targetSlot + 1]; ++q) {
+            if (portals[q].targetSlot == portal.slot) {
+                portal.arrival = static_cast<int>(q);
+                portal.arrivalPoint = portals[q].point;
+                break;
+            }
+        }
+    }
+
+    // Intra-room portal-to-portal distances: one flow field per portal
+    FlowField field;
+    for (std::size_t slot = 0; slot < roomCount; ++slot) {
+        std::size_t first = portalStart[slot];
+        std::size_t count = portalStart[slot + 1] - first;
+        costStart[slot] = intraCost.size();
+        intraCost.resize(intraCost.size() + count * count, -1.0f);
+
+        const CollisionMap& map = table.at(static_cast<int>(slot))->getCollisionMap();
+        for (std::size_t i = 0; i < count; ++i) {
+            field.reset(map, portals[first + i].point);
+            while (!field.step(std::numeric_limits<int>::max())) {}
+            for (std::size_t j = 0; j < count; ++j) {
+                intraCost[costStart[slot] + i * count + j] = field.distanceFrom(portals[first + j].point);
+            }
+        }
+    }
+    costStart[roomCount] = intraCost.size();
+}
+
+void RoomRouter::clear() {
+    rooms = nullptr;
+    portals.clear();
+    portalStart.clear();
+    costStart.clear();
+    intraCost.clear();
+}
+
+bool RoomRouter::canPass(const Door& door, const Inventory* keys) {
+    if (!door.getLockedStatus() || !keys) return true;
+    ItemID keyID = door.getRequiredKeyID();
+    return keyID == INVALID_ITEM_ID || keys->hasKey(keyID);
+}
+
+// Walking distance inside the room behind 'crossed', from where it comes out to portal toPortal
+float RoomRouter::walkCost(const Portal& crossed, int toPortal) const {
+    if (crossed.arrival < 0) return octileDistance(crossed.arrivalPoint, portals[toPortal].point);
+    std::size_t first = portalStart[crossed.targetSlot];
+    std::size_t count = portalStart[crossed.targetSlot + 1] - first;
+    return intraCost[costStart[crossed.targetSlot] + (crossed.arrival - first) * count + (toPortal - first)];
+}
+
+bool RoomRouter::findRoute(int fromRoomID, const sf::Vector2f& from, int toRoomID, const sf::Vector2f& to,
+                           const Inventory* keys, RoomRoute& route) {
+    route.steps.clear();
+    route.arrivalPoint = from;
+    route.length = 0.0f;
+    if (!rooms) return false;
+
+    int fromSlot = rooms->getSlot(fromRoomID);
+    int toSlot = rooms->getSlot(toRoomID);
+    if (fromSlot < 0 || toSlot < 0) return false;
+    if (fromSlot == toSlot) {
+        route.length = octileDistance(from, to);
+        return true;
+    }
+
+    distance.assign(portals.size(), NO_ROUTE);
+    previous.assign(portals.size(), -1);
+    open.clear();
+    auto push = [this](float cost, int portal) {
+        open.push_back({cost, portal});
+        std::push_heap(open.begin(), open.end(), std::greater<std::pair<float, int>>());
+    };
+
+    for (std::size_t p = portalStart[fromSlot]; p < portalStart[fromSlot + 1]; ++p) {
+        distance[p] = octileDistance(from, portals[p].point);
+        push(distance[p], static_cast<int>(p));
+    }
+
+    // Dijkstra over portals; distance[p] = cost to stand at door p, about to go through
+    float best = NO_ROUTE;
+    int bestPortal = -1;
+    while (!open.empty()) {
+        std::pop_heap(open.begin(), open.end(), std::greater<std::pair<float, int>>());
+        auto [cost, p] = open.back();
+        open.pop_back();
+        if (cost > distance[p]) continue; // Stale entry
+        if (cost >= best) break;
+
+        const Portal& portal = portals[p];
+        if (!canPass(*portal.door, keys)) continue;
+
+        if (portal.targetSlot == toSlot) {
+            float total = cost + octileDistance(portal.arrivalPoint, to);
+            if (total < best) {
+                best = total;
+                bestPortal = p;
+            }
+            continue;
+        }
+
+        for (std::size_t q = portalStart[portal.targetSlot]; q < portalStart[portal.targetSlot + 1]; ++q) {
+            float walk = walkCost(portal, static_cast<int>(q));
+            if (walk < 0.0f) continue;
+            if (cost + walk < distance[q]) {
+                distance[q] = cost + walk;
+                previous[q] = p;
+                push(distance[q], static_cast<int>(q));
+            }
+        }
+    }
+    if (bestPortal < 0) return false;
+
+    for (int p = bestPortal; p != -1; p = previous[p]) {
+        const Portal& portal = portals[p];
+        route.steps.push_back({rooms->at(portal.slot)->getRoomID(), portal.door, portal.point,
+                               rooms->at(portal.targetSlot)->getRoomID()});
+    }
+    std::reverse(route.steps.begin(), route.steps.end());
+    route.arrivalPoint = portals[bestPortal].arrivalPoint;
+    route.length = best;
+    return true;
+}
+
+std::size_t RoomRouter::getPortalCount() const { return portals.size(); }
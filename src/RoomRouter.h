@@ -0,0 +1,73 @@
+#ifndef ROOMROUTER_H
+#define ROOMROUTER_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+class RoomTable;
+class Door;
+class Inventory;
+
+// One door to walk through on a cross-room route
+struct RouteStep {
+    int roomID;             // Room the door is in
+    Door* door;
+    sf::Vector2f doorPoint; // Centre of the door
+    int nextRoomID;         // Room on the other side
+};
+
+struct RoomRoute {
+    std::vector<RouteStep> steps; // Empty when start and goal share a room
+    sf::Vector2f arrivalPoint;    // Where the last door comes out (the start point if no steps)
+    float length = 0.0f;          // Walking distance in pixels
+};
+
+// RoomRouter - hierarchical (HPA*-style) pathfinding across rooms.
+// Every door is a portal node. build() runs one flow field per portal over its
+// room's collision map and keeps the portal-to-portal walking distances, so a
+// query is a Dijkstra over portals only - its cost depends on the number of
+// doors, never on room size or tile count. Start and goal are joined to their
+// rooms' portals by straight-line (octile) estimates.
+class RoomRouter {
+private:
+    struct Portal {
+        int slot;             // RoomTable slot of the door's room
+        int targetSlot;
+        Door* door;
+        sf::Vector2f point;
+        int arrival;          // Portal we come out at on the far side (-1 = none; use arrivalPoint)
+        sf::Vector2f arrivalPoint;
+    };
+
+    const RoomTable* rooms;
+    std::vector<Portal> portals;          // Indexed like RoomTable edges - grouped by slot
+    std::vector<std::size_t> portalStart; // Slot -> first portal (size + 1 entries)
+    std::vector<std::size_t> costStart;   // Slot -> that room's portal x portal matrix in intraCost
+    std::vector<float> intraCost;         // Negative = no walkable path inside the room
+
+    // Query scratch, kept between queries so routing does not allocate
+    std::vector<float> distance;
+    std::vector<int> previous;
+    std::vector<std::pair<float, int>> open;
+
+public:
+    RoomRouter();
+
+    // Precompute portals and intra-room costs; call after RoomTable::buildDoorGraph()
+    void build(const RoomTable& table);
+    void clear();
+
+    // keys = nullptr ignores locks (guards); otherwise a locked door needs its key in the inventory
+    bool findRoute(int fromRoomID, const sf::Vector2f& from, int toRoomID, const sf::Vector2f& to,
+                   const Inventory* keys, RoomRoute& route);
+
+    static bool canPass(const Door& door, const Inventory* keys);
+    std::size_t getPortalCount() const;
+
+private:
+    float walkCost(const Portal& crossed, int toPortal) const;
+};
+
+#endif // ROOMROUTER_H
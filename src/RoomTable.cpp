@@ -0,0 +1,62 @@
+/*
+ * Museum Escape - Room Table Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "RoomTable.h"
+#include "Room.h"
+
+RoomTable::RoomTable() : edgeStart(1, 0) {}
+
+void RoomTable::clear() {
+    rooms.clear();
+    slotByID.clear();
+    edges.clear();
+    edgeStart.assign(1, 0);
+}
+
+int RoomTable::add(Room* room) {
+    int id = room->getRoomID();
+    if (id >= static_cast<int>(slotByID.size())) {
+        slotByID.resize(id + 1, -1);
+    }
+
+    int slot = static_cast<int>(rooms.size());
+    slotByID[id] = slot;
+    rooms.push_back(room);
+    return slot;
+}
+
+void RoomTable::buildDoorGraph() {
+    edges.clear();
+    edgeStart.assign(rooms.size() + 1, 0);
+
+    for (std::size_t slot = 0; slot < rooms.size(); ++slot) {
+        edgeStart[slot] = edges.size();
+        for (Door* door : rooms[slot]->getDoors()) {
+            int target = getSlot(door->getTargetRoomID());
+            if (target >= 0) edges.push_back({target, door});
+        }
+    }
+    edgeStart[rooms.size()] = edges.size();
+}
+
+Room* RoomTable::find(int roomID) const {
+    int slot = getSlot(roomID);
+    return slot >= 0 ? rooms[slot] : nullptr;
+}
+
+int RoomTable::getSlot(int roomID) const {
+    if (roomID < 0 || roomID >= static_cast<int>(slotByID.size())) return -1;
+    return slotByID[roomID];
+}
+
+Room* RoomTable::at(int slot) const { return rooms[slot]; }
+std::size_t RoomTable::size() const { return rooms.size(); }
+bool RoomTable::empty() const { return rooms.empty(); }
+
+std::vector<Room*>::const_iterator RoomTable::begin() const { return rooms.begin(); }
+std::vector<Room*>::const_iterator RoomTable::end() const { return rooms.end(); }
+
+const RoomEdge* RoomTable::edgesBegin(int slot) const { return edges.data() + edgeStart[slot]; }
+const RoomEdge* RoomTable::edgesEnd(int slot) const { return edges.data() + edgeStart[slot + 1]; }
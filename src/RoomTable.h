@@ -0,0 +1,51 @@
+#ifndef ROOMTABLE_H
+#define ROOMTABLE_H
+
+#include <vector>
+#include <cstddef>
+
+class Room;
+class Door;
+
+// One door edge of the room graph
+struct RoomEdge {
+    int toSlot;  // Dense slot of the room behind the door
+    Door* door;
+};
+
+// RoomTable - dense storage for the level's rooms.
+// Rooms are addressed by compact slots (0..size-1); room IDs map to slots through
+// a flat lookup array, so finding a room is an index, never a tree walk.
+// The door graph is kept in CSR form: the doors of slot i are
+// edges[edgeStart[i] .. edgeStart[i + 1]).
+class RoomTable {
+private:
+    std::vector<Room*> rooms;         // Non-owning (rooms live in the LevelArena)
+    std::vector<int> slotByID;        // Room ID -> slot, -1 if unused
+    std::vector<std::size_t> edgeStart;
+    std::vector<RoomEdge> edges;
+
+public:
+    RoomTable();
+
+    void clear();
+    int add(Room* room); // Returns the room's slot
+    void buildDoorGraph(); // Call once every door has been added
+
+    // Lookup
+    Room* find(int roomID) const; // nullptr if no such room
+    int getSlot(int roomID) const; // -1 if no such room
+    Room* at(int slot) const;
+    std::size_t size() const;
+    bool empty() const;
+
+    // Iteration over all rooms
+    std::vector<Room*>::const_iterator begin() const;
+    std::vector<Room*>::const_iterator end() const;
+
+    // Door graph
+    const RoomEdge* edgesBegin(int slot) const;
+    const RoomEdge* edgesEnd(int slot) const;
+};
+
+#endif // ROOMTABLE_H
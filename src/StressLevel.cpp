@@ -0,0 +1,152 @@
+/*
+ * Museum Escape - Stress Level Generator Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "StressLevel.h"
+#include <algorithm>
+#include <random>
+#include <set>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+namespace {
+    const int ROOM_WIDTH = 800;
+    const int ROOM_HEIGHT = 600;
+
+    // Doors (50x100) stand in slots down the left and right walls
+    const int DOOR_SLOTS_PER_SIDE = 6;
+    const int DOOR_SLOTS = DOOR_SLOTS_PER_SIDE * 2;
+    const int DOOR_RIGHT_X = 750;
+    const int DOOR_SPACING = 100;
+    const int PARENT_WINDOW = 4; // A new room hangs off one of the last few rooms
+
+    // 32x32 pillars on a 160px lattice, with lanes running clear of them
+    const int PILLAR_SIZE = 32;
+    const int PILLAR_COLUMNS[] = { 150, 310, 470, 630 };
+    const int PILLAR_ROWS[] = { 170, 330, 490 };
+    const int LANE_ROWS[] = { 100, 260, 420 };
+    const int LANE_COLUMNS[] = { 80, 240, 400, 560, 720 };
+
+    // A point on a random lane; points sharing a lane connect in a straight line
+    struct Lane {
+        bool horizontal;
+        int offset;
+    };
+
+    Lane randomLane(std::mt19937& rng) {
+        std::uniform_int_distribution<int> pick(0, 7);
+        int lane = pick(rng);
+        if (lane < 3) return {true, LANE_ROWS[lane]};
+        return {false, LANE_COLUMNS[lane - 3]};
+    }
+
+    std::pair<int, int> pointOnLane(const Lane& lane, std::mt19937& rng) {
+        std::uniform_int_distribution<int> along(40, lane.horizontal ? 720 : 520);
+        int position = along(rng);
+        return lane.horizontal ? std::make_pair(position, lane.offset) : std::make_pair(lane.offset, position);
+    }
+
+    std::pair<int, int> doorPosition(int slot) {
+        int x = (slot % 2 == 0) ? 0 : DOOR_RIGHT_X; // Alternate sides
+        int y = (slot / 2) * DOOR_SPACING;
+        return {x, y};
+    }
+}
+
+std::string generateStressLevel(const StressLevelOptions& options) {
+    std::mt19937 rng(options.seed);
+    int roomCount = std::max(1, options.roomCount);
+    std::ostringstream out;
+
+    out << "# Generated stress level: " << roomCount << " rooms, " << options.guardsPerRoom
+        << " guards per room, " << options.itemCount << " items, seed " << options.seed << "\n\n";
+    out << "start 1 100 100\n\n";
+
+    for (int room = 1; room <= roomCount; ++room) {
+        out << "room " << room << " \"Stress Room " << room << "\" 0 0 " << ROOM_WIDTH << ' ' << ROOM_HEIGHT << "\n";
+    }
+    out << "exit " << roomCount << "\n\n";
+
+    if (options.pillars) {
+        for (int room = 1; room <= roomCount; ++room) {
+            for (int x : PILLAR_COLUMNS) {
+                for (int y : PILLAR_ROWS) {
+                    out << "wall " << room << ' ' << x << ' ' << y << ' ' << PILLAR_SIZE << ' ' << PILLAR_SIZE << "\n";
+                }
+            }
+        }
+        out << "\n";
+    }
+
+    // === DOORS === spanning tree first, then extra links while slots last
+    std::vector<int> usedSlots(roomCount + 1, 0);
+    std::set<std::pair<int, int>> linked;
+    std::vector<std::pair<int, int>> keys; // (room the key is in, room it opens)
+
+    auto link = [&](int from, int to, const std::string& key) {
+        std::pair<int, int> fromDoor = doorPosition(usedSlots[from]++);
+        std::pair<int, int> toDoor = doorPosition(usedSlots[to]++);
+        out << "door " << from << ' ' << fromDoor.first << ' ' << fromDoor.second << ' ' << to;
+        if (!key.empty()) out << " \"" << key << "\"";
+        out << "\n";
+        out << "door " << to << ' ' << toDoor.first << ' ' << toDoor.second << ' ' << from << "\n";
+        linked.insert({std::min(from, to), std::max(from, to)});
+    };
+
+    for (int room = 2; room <= roomCount; ++room) {
+        std::vector<int> candidates;
+        for (int parent = std::max(1, room - PARENT_WINDOW); parent < room; ++parent) {
+            if (usedSlots[parent] < DOOR_SLOTS) candidates.push_back(parent);
+        }
+        if (candidates.empty()) candidates.push_back(room - 1); // Overlapping doors still work
+        int parent = candidates[std::uniform_int_distribution<int>(0, static_cast<int>(candidates.size()) - 1)(rng)];
+
+        // The key for a locked room lies in an earlier room - reachable before this door
+        std::string key;
+        if (options.lockEvery > 0 && room % options.lockEvery == 0) {
+            key = "stress_key_" + std::to_string(room);
+            keys.push_back({std::uniform_int_distribution<int>(1, room - 1)(rng), room});
+        }
+        link(parent, room, key);
+    }
+
+    std::uniform_int_distribution<int> anyRoom(1, roomCount);
+    for (int extra = 0; extra < roomCount / 4; ++extra) {
+        int a = anyRoom(rng);
+        int b = anyRoom(rng);
+        if (a == b || linked.count({std::min(a, b), std::max(a, b)})) continue;
+        if (usedSlots[a] >= DOOR_SLOTS || usedSlots[b] >= DOOR_SLOTS) continue;
+        link(a, b, "");
+    }
+    out << "\n";
+
+    // === ITEMS ===
+    for (const auto& [keyRoom, lockedRoom] : keys) {
+        std::pair<int, int> at = pointOnLane(randomLane(rng), rng);
+        out << "item " << keyRoom << " key \"Key " << lockedRoom << "\" \"stress_key_" << lockedRoom << "\" "
+            << at.first << ' ' << at.second << "\n";
+    }
+    for (int item = 1; item <= options.itemCount; ++item) {
+        std::pair<int, int> at = pointOnLane(randomLane(rng), rng);
+        out << "item " << anyRoom(rng) << " basic \"Artifact " << item << "\" \"Stress item\" "
+            << at.first << ' ' << at.second << "\n";
+    }
+    out << "\n";
+
+    // === GUARDS === each walks back and forth along one lane
+    std::uniform_int_distribution<int> patrolLength(2, 4);
+    std::uniform_int_distribution<int> range(90, 130);
+    for (int room = 1; room <= roomCount; ++room) {
+        for (int guard = 0; guard < options.guardsPerRoom; ++guard) {
+            Lane lane = randomLane(rng);
+            std::vector<std::pair<int, int>> points;
+            for (int i = patrolLength(rng); i > 0; --i) points.push_back(pointOnLane(lane, rng));
+
+            out << "guard " << room << ' ' << points[0].first << ' ' << points[0].second << ' ' << range(rng) << "\n";
+            for (const auto& point : points) out << "patrol " << point.first << ' ' << point.second << "\n";
+        }
+    }
+    return out.str();
+}
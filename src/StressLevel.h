@@ -0,0 +1,23 @@
+#ifndef STRESSLEVEL_H
+#define STRESSLEVEL_H
+
+#include <string>
+
+// Settings for a synthetic level (game.exe --generate)
+struct StressLevelOptions {
+    int roomCount = 50;
+    int guardsPerRoom = 4;
+    int itemCount = 100;  // Plain items, on top of the keys
+    int lockEvery = 3;    // Every Nth room is behind a locked door (0 = no locks)
+    bool pillars = true;  // A grid of solid pillars in every room
+    unsigned seed = 1;
+};
+
+// A level in the text format (see assets/museum.lvl) for measuring how the
+// game scales past the hand-made museum. Rooms hang off a random spanning tree
+// plus a few extra links, so every room is reachable; each locked door's key
+// lies in a room that can be reached without it. Guards patrol straight lanes
+// that run between the pillars. The same options always give the same level.
+std::string generateStressLevel(const StressLevelOptions& options);
+
+#endif // STRESSLEVEL_H
@@ -4,20 +4,31 @@
  */
 
 #include "Timer.h"
-#include <sstream>
-#include <iomanip>
+#include <algorithm>
 
 // Constructor
-Timer::Timer(float totalSeconds)
-    : totalTime(totalSeconds),
-      remainingTime(totalSeconds),
+namespace {
+    // Seconds as given by callers (bonuses, thresholds) to exact ticks
+    Timer::Duration toDuration(float seconds) {
+        return std::chrono::round<Timer::Duration>(std::chrono::duration<double>(seconds));
+    }
+}
+
+Timer::Timer(TimerWheel& timerWheel, float totalSeconds)
+    : wheel(timerWheel),
+      expiryTimer(NO_TIMER),
+      refreshTimer(NO_TIMER),
+      totalTime(toDuration(totalSeconds)),
+      remainingTime(totalTime),
+      bonusTime(Duration::zero()),
+      penaltyTime(Duration::zero()),
       isRunning(false),
       hasExpired(false),
       normalColor(sf::Color::White),
       warningColor(sf::Color::Yellow),
       criticalColor(sf::Color::Red),
-      warningThreshold(60.0f),
-      criticalThreshold(30.0f),
+      warningThreshold(std::chrono::seconds(60)),
+      criticalThreshold(std::chrono::seconds(30)),
       displayPosition(10.0f, 10.0f),
       timerText(defaultFont),
       background({200.0f, 50.0f})
@@ -29,98 +40,141 @@ Timer::Timer(float totalSeconds)
     background.setPosition(displayPosition);
     
     // Setup text (will set font later)
-    timerText.setCharacterSize(24);
-    timerText.setFillColor(normalColor);
-    timerText.setPosition({displayPosition.x + 10.0f, displayPosition.y + 10.0f});
+    timerText.getText().setCharacterSize(24);
+    timerText.getText().setFillColor(normalColor);
+    timerText.getText().setPosition({displayPosition.x + 10.0f, displayPosition.y + 10.0f});
+    refreshDisplay();
+}
+
+Timer::~Timer() {
+    wheel.cancel(expiryTimer);
+    wheel.cancel(refreshTimer);
 }
 
 // Start timer
 void Timer::start() {
     isRunning = true;
     hasExpired = false;
+    schedule();
 }
 
 // Pause timer
 void Timer::pause() {
+    unschedule();
     isRunning = false;
 }
 
 // Resume timer
 void Timer::resume() {
-    if (!hasExpired) {
+    if (!hasExpired && !isRunning) {
         isRunning = true;
+        schedule();
     }
 }
 
 // Reset timer
 void Timer::reset() {
+    unschedule();
     remainingTime = totalTime;
+    bonusTime = penaltyTime = Duration::zero();
     isRunning = false;
     hasExpired = false;
+    refreshDisplay();
 }
 
 // Stop timer
 void Timer::stop() {
+    unschedule();
     isRunning = false;
 }
 
-// Update timer
-void Timer::update(float deltaTime) {
-    if (!isRunning || hasExpired) {
-        return;
+void Timer::schedule() {
+    wheel.cancel(expiryTimer);
+    expiryTimer = wheel.schedule(remainingTime, [this]() { expire(); });
+    refreshDisplay();
+}
+
+void Timer::unschedule() {
+    if (isRunning) remainingTime = wheel.remaining(expiryTimer);
+    wheel.cancel(expiryTimer);
+    wheel.cancel(refreshTimer);
+    expiryTimer = refreshTimer = NO_TIMER;
+}
+
+void Timer::expire() {
+    unschedule();
+    remainingTime = Duration::zero();
+    hasExpired = true;
+    isRunning = false;
+    refreshDisplay();
+    if (onExpired) onExpired();
+}
+
+// Color and text for the current time; while running, called again just
+// after the shown seconds next change
+void Timer::refreshDisplay() {
+    Duration remaining = getRemaining();
+    if (remaining <= criticalThreshold) {
+        timerText.getText().setFillColor(criticalColor);
+    } else if (remaining <= warningThreshold) {
+        timerText.getText().setFillColor(warningColor);
+    } else {
+        timerText.getText().setFillColor(normalColor);
     }
     
-    // Decrease time
-    remainingTime -= deltaTime;
+    FixedText<16> label;
+    label.append("Time: ");
+    formatTime(label);
+    timerText.set(label.view()); // Only marked dirty when the seconds change
     
-    // Check if expired
-    if (remainingTime <= 0.0f) {
-        remainingTime = 0.0f;
-        hasExpired = true;
-        isRunning = false;
+    wheel.cancel(refreshTimer);
+    refreshTimer = NO_TIMER;
+    Duration nextChange = remaining % std::chrono::seconds(1) + Duration(1);
+    if (isRunning && nextChange <= remaining) {
+        refreshTimer = wheel.schedule(nextChange, [this]() { refreshDisplay(); });
     }
-    
-    // Update text color based on remaining time
-    if (remainingTime <= criticalThreshold) {
-        timerText.setFillColor(criticalColor);
-    } else if (remainingTime <= warningThreshold) {
-        timerText.setFillColor(warningColor);
-    } else {
-        timerText.setFillColor(normalColor);
-    }
-    
-    // Update text
-    timerText.setString("Time: " + getFormattedTime());
 }
 
 // Add time (bonus)
 void Timer::addTime(float seconds) {
-    remainingTime += seconds;
-    if (remainingTime > totalTime) {
-        remainingTime = totalTime;
-    }
+    Duration before = getRemaining();
+    remainingTime = std::min(totalTime, before + toDuration(seconds));
+    bonusTime += remainingTime - before;
+    if (isRunning) schedule();
+    else refreshDisplay();
 }
 
 // Subtract time (penalty)
 void Timer::subtractTime(float seconds) {
-    remainingTime -= seconds;
-    if (remainingTime < 0.0f) {
-        remainingTime = 0.0f;
-        hasExpired = true;
-        isRunning = false;
-    }
+    Duration before = getRemaining();
+    remainingTime = std::max(Duration::zero(), before - toDuration(seconds));
+    penaltyTime += before - remainingTime;
+    if (remainingTime == Duration::zero() && !hasExpired) expire();
+    else if (isRunning) schedule();
+    else refreshDisplay();
+}
+
+// Set expiry callback
+void Timer::setExpiryCallback(std::function<void()> callback) {
+    onExpired = std::move(callback);
 }
 
 // Get remaining time
 float Timer::getRemainingTime() const {
-    return remainingTime;
+    return std::chrono::duration<float>(getRemaining()).count();
 }
 
 // Get total time
 float Timer::getTotalTime() const {
-    return totalTime;
+    return std::chrono::duration<float>(totalTime).count();
 }
 
+Timer::Duration Timer::getRemaining() const {
+    return isRunning ? wheel.remaining(expiryTimer) : remainingTime;
+}
+Timer::Duration Timer::getBonusTime() const { return bonusTime; }
+Timer::Duration Timer::getPenaltyTime() const { return penaltyTime; }
+
 // Check if running
 bool Timer::isTimerRunning() const {
     return isRunning;
@@ -133,40 +187,44 @@ bool Timer::isExpired() const {
 
 // Get formatted time string (MM:SS)
 std::string Timer::getFormattedTime() const {
-    int minutes = static_cast<int>(remainingTime) / 60;
-    int seconds = static_cast<int>(remainingTime) % 60;
-    
-    std::ostringstream oss;
-    oss << std::setfill('0') << std::setw(2) << minutes << ":"
-        << std::setfill('0') << std::setw(2) << seconds;
-    
-    return oss.str();
+    FixedText<16> text;
+    formatTime(text);
+    return std::string(text.view());
+}
+
+void Timer::formatTime(FixedText<16>& out) const {
+    long wholeSeconds = static_cast<long>(std::chrono::duration_cast<std::chrono::seconds>(getRemaining()).count());
+    long minutes = wholeSeconds / 60;
+    long seconds = wholeSeconds % 60;
+    out.appendNumber(minutes, 2).append(":").appendNumber(seconds, 2);
 }
 
 // Set display position
 void Timer::setDisplayPosition(float x, float y) {
     displayPosition = {x, y};
     background.setPosition(displayPosition);
-    timerText.setPosition({displayPosition.x + 10.0f, displayPosition.y + 10.0f});
+    timerText.getText().setPosition({displayPosition.x + 10.0f, displayPosition.y + 10.0f});
 }
 
 // Set font
 void Timer::setFont(const sf::Font& f) {
-    timerText.setFont(f);
+    timerText.getText().setFont(f);
 }
 
 // Set warning threshold
 void Timer::setWarningThreshold(float seconds) {
-    warningThreshold = seconds;
+    warningThreshold = toDuration(seconds);
+    refreshDisplay();
 }
 
 // Set critical threshold
 void Timer::setCriticalThreshold(float seconds) {
-    criticalThreshold = seconds;
+    criticalThreshold = toDuration(seconds);
+    refreshDisplay();
 }
 
 // Draw timer
-void Timer::draw(sf::RenderWindow& window) {
-    window.draw(background);
-    window.draw(timerText);
+void Timer::draw(RenderQueue& queue) {
+    queue.submit(RenderLayer::HudPanels, background);
+    timerText.draw(queue);
 }
\ No newline at end of file
@@ -3,18 +3,35 @@
 
 #include <SFML/Graphics.hpp>
 #include <string>
+#include <functional>
+#include <chrono>
+#include "Hud.h"
+#include "TimerWheel.h"
+#include "RenderQueue.h"
 
+// Countdown in integer nanoseconds on the game's TimerWheel: while running,
+// the expiry is one wheel timer and the remaining time is read back from it,
+// so 600 seconds of frames take exactly 600 seconds off. A second timer
+// refreshes the display when the shown seconds change - nothing runs per frame.
 class Timer {
+public:
+    using Duration = std::chrono::nanoseconds;
+
 private:
-    float totalTime; // Total time in seconds
-    float remainingTime;
+    TimerWheel& wheel;
+    TimerId expiryTimer;  // Pending while running
+    TimerId refreshTimer; // Next change of the shown MM:SS
+    Duration totalTime;
+    Duration remainingTime; // Kept up to date only while stopped; see getRemaining
+    Duration bonusTime;   // Actually added by addTime (after the cap at totalTime)
+    Duration penaltyTime; // Actually removed by subtractTime
     bool isRunning;
     bool hasExpired;
     
     // Display
     sf::Font defaultFont; // Default font for initialization
     sf::Font font;
-    sf::Text timerText;
+    HudText timerText; // Re-laid out only when the shown MM:SS changes
     sf::RectangleShape background;
     sf::Vector2f displayPosition;
     
@@ -22,12 +39,22 @@ private:
     sf::Color normalColor;
     sf::Color warningColor; // When time is low
     sf::Color criticalColor; // When time is very low
-    float warningThreshold; // Show warning below this time (e.g., 60 seconds)
-    float criticalThreshold; // Show critical below this time (e.g., 30 seconds)
+    Duration warningThreshold; // Show warning below this time (e.g., 60 seconds)
+    Duration criticalThreshold; // Show critical below this time (e.g., 30 seconds)
+    
+    std::function<void()> onExpired; // Fired once when the countdown hits zero
+    
+    void schedule();   // Register the expiry and the next refresh from remainingTime
+    void unschedule(); // Capture remainingTime and drop both timers
+    void expire();
+    void refreshDisplay();
     
 public:
     // Constructor
-    Timer(float totalSeconds = 600.0f); // Default 10 minutes
+    Timer(TimerWheel& timerWheel, float totalSeconds = 600.0f); // Default 10 minutes
+    ~Timer(); // Cancels its timers - the wheel must outlive it
+    Timer(const Timer&) = delete; // The wheel holds callbacks to this object
+    Timer& operator=(const Timer&) = delete;
     
     // Timer controls
     void start();
@@ -36,19 +63,23 @@ public:
     void reset();
     void stop();
     
-    // Time management
-    void update(float deltaTime);
+    // Time management - the wheel does the counting
     void addTime(float seconds); // Bonus time for solving puzzles
     void subtractTime(float seconds); // Penalty for failing
+    void setExpiryCallback(std::function<void()> callback);
     
     // Time queries
-    float getRemainingTime() const;
-    float getTotalTime() const;
+    float getRemainingTime() const; // Seconds
+    float getTotalTime() const;     // Seconds
+    Duration getRemaining() const;
+    Duration getBonusTime() const;
+    Duration getPenaltyTime() const;
     bool isTimerRunning() const;
     bool isExpired() const;
     
     // Display formatting
     std::string getFormattedTime() const; // Returns "MM:SS" format
+    void formatTime(FixedText<16>& out) const; // Appends "MM:SS", no allocation
     void setDisplayPosition(float x, float y);
     void setFont(const sf::Font& f);
     
@@ -57,7 +88,7 @@ public:
     void setCriticalThreshold(float seconds);
     
     // Rendering
-    void draw(sf::RenderWindow& window);
+    void draw(RenderQueue& queue);
 };
 
 #endif // TIMER_H
\ No newline at end of file
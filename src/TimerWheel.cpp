@@ -0,0 +1,173 @@
+/*
+ * Museum Escape - Timer Wheel Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "TimerWheel.h"
+#include <algorithm>
+
+namespace {
+    const std::uint64_t SLOT_MASK = TimerWheel::SLOTS - 1;
+    const unsigned TOP_LEVEL = TimerWheel::LEVELS - 1;
+    const std::uint64_t TOP_TURN = std::uint64_t(1) << (TimerWheel::SLOT_BITS * TimerWheel::LEVELS); // Ticks
+
+    std::uint64_t ticksUntil(TimerWheel::Duration time) {
+        // Rounded up - a timer never fires before its deadline
+        std::int64_t ticks = (time.count() + TimerWheel::TICK.count() - 1) / TimerWheel::TICK.count();
+        return static_cast<std::uint64_t>(std::max<std::int64_t>(ticks, 0));
+    }
+}
+
+TimerWheel::TimerWheel() : freeList(NONE), pending(0), now(Duration::zero()), tick(0) {
+    heads.fill(NONE);
+}
+
+// ============================================================================
+// SLOT LISTS
+// ============================================================================
+
+// The level is the highest 6-bit digit in which the expiry differs from the
+// current tick, so the slot comes round exactly when that digit does. A top
+// digit that wrapped still works within one turn; anything further waits in
+// the top slot of the current digit - a whole turn away - and is placed again
+// when it cascades.
+void TimerWheel::link(std::uint32_t index) {
+    Node& node = nodes[index];
+    std::uint64_t diff = node.expiry ^ tick;
+    unsigned level = 0;
+    while (level < LEVELS && (diff >> (SLOT_BITS * (level + 1))) != 0) ++level;
+
+    std::uint64_t slotIndex = (node.expiry >> (SLOT_BITS * std::min(level, TOP_LEVEL))) & SLOT_MASK;
+    if (level > TOP_LEVEL) {
+        level = TOP_LEVEL;
+        if (node.expiry - tick >= TOP_TURN) slotIndex = (tick >> (SLOT_BITS * TOP_LEVEL)) & SLOT_MASK;
+    }
+
+    node.slot = static_cast<std::uint32_t>(level * SLOTS + slotIndex);
+    node.prev = NONE;
+    node.next = heads[node.slot];
+    if (node.next != NONE) nodes[node.next].prev = index;
+    heads[node.slot] = index;
+}
+
+void TimerWheel::unlink(std::uint32_t index) {
+    Node& node = nodes[index];
+    if (node.prev != NONE) nodes[node.prev].next = node.next;
+    else heads[node.slot] = node.next;
+    if (node.next != NONE) nodes[node.next].prev = node.prev;
+}
+
+void TimerWheel::release(std::uint32_t index) {
+    Node& node = nodes[index];
+    node.callback = nullptr;
+    node.slot = NONE;
+    ++node.generation;
+    node.next = freeList;
+    freeList = index;
+    --pending;
+}
+
+TimerWheel::Node* TimerWheel::find(TimerId id) {
+    return const_cast<Node*>(static_cast<const TimerWheel*>(this)->find(id));
+}
+
+const TimerWheel::Node* TimerWheel::find(TimerId id) const {
+    std::uint64_t index = (id & 0xFFFFFFFFu) - 1;
+    if (id == NO_TIMER || index >= nodes.size()) return nullptr;
+    const Node& node = nodes[index];
+    if (node.slot == NONE || node.generation != static_cast<std::uint32_t>(id >> 32)) return nullptr;
+    return &node;
+}
+
+// ============================================================================
+// SCHEDULING
+// ============================================================================
+
+TimerId TimerWheel::schedule(Duration delay, std::function<void()> callback) {
+    std::uint32_t index = freeList;
+    if (index != NONE) {
+        freeList = nodes[index].next;
+    } else {
+        index = static_cast<std::uint32_t>(nodes.size());
+        nodes.push_back(Node{Duration::zero(), 0, nullptr, NONE, NONE, NONE, 0});
+    }
+
+    Node& node = nodes[index];
+    node.deadline = now + std::max(delay, Duration::zero());
+    node.expiry = std::max(ticksUntil(node.deadline), tick + 1); // This tick is already done
+    node.callback = std::move(callback);
+    link(index);
+    ++pending;
+    return (static_cast<TimerId>(node.generation) << 32) | (index + 1);
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    Node* node = find(id);
+    if (!node) return false;
+    std::uint32_t index = static_cast<std::uint32_t>(node - nodes.data());
+    unlink(index);
+    release(index);
+    return true;
+}
+
+bool TimerWheel::isPending(TimerId id) const { return find(id) != nullptr; }
+
+TimerWheel::Duration TimerWheel::remaining(TimerId id) const {
+    const Node* node = find(id);
+    return node ? std::max(node->deadline - now, Duration::zero()) : Duration::zero();
+}
+
+// ============================================================================
+// ADVANCING
+// ============================================================================
+
+// Moves a finished turn's slot down: its timers are all due within the next
+// turn of the level below (or now, landing in the slot fired this tick)
+void TimerWheel::cascade(unsigned level) {
+    std::uint32_t slot = static_cast<std::uint32_t>(level * SLOTS + ((tick >> (SLOT_BITS * level)) & SLOT_MASK));
+    std::uint32_t index = heads[slot];
+    heads[slot] = NONE;
+    while (index != NONE) {
+        std::uint32_t next = nodes[index].next;
+        link(index);
+        index = next;
+    }
+}
+
+// One at a time from the head, so a callback may cancel or add timers
+void TimerWheel::fire() {
+    std::uint32_t slot = static_cast<std::uint32_t>(tick & SLOT_MASK);
+    while (heads[slot] != NONE) {
+        std::uint32_t index = heads[slot];
+        unlink(index);
+        std::function<void()> callback = std::move(nodes[index].callback);
+        release(index); // Before the call, so the callback can reuse the node
+        if (callback) callback();
+    }
+}
+
+void TimerWheel::advance(Duration elapsed) {
+    Duration target = now + std::max(elapsed, Duration::zero());
+    std::uint64_t targetTick = static_cast<std::uint64_t>(target / TICK);
+
+    while (tick < targetTick && pending > 0) {
+        ++tick;
+        now = tick * TICK; // What callbacks see
+        for (unsigned level = TOP_LEVEL; level > 0; --level) {
+            if ((tick & ((std::uint64_t(1) << (SLOT_BITS * level)) - 1)) == 0) cascade(level);
+        }
+        fire();
+    }
+    tick = targetTick; // Nothing pending - skip the empty ticks
+    now = target;
+}
+
+void TimerWheel::clear() {
+    for (std::uint32_t index = 0; index < nodes.size(); ++index) {
+        if (nodes[index].slot != NONE) release(index);
+    }
+    heads.fill(NONE);
+}
+
+TimerWheel::Duration TimerWheel::getNow() const { return now; }
+std::size_t TimerWheel::getPendingCount() const { return pending; }
@@ -0,0 +1,75 @@
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// Handle to a scheduled timer; stale once it fires or is cancelled
+using TimerId = std::uint64_t;
+constexpr TimerId NO_TIMER = 0;
+
+// TimerWheel - every countdown in the game (timer expiry, guard cooldowns,
+// notifications, fades) registered once with a callback instead of being
+// decremented by hand each frame. Hierarchical: LEVELS wheels of SLOTS slots,
+// each level's slot spanning a whole turn of the level below, so a 1 ms tick
+// reaches hours ahead. Scheduling and cancelling are O(1) (intrusive slot
+// lists over a pooled node array); a tick touches one slot, plus one slot per
+// level whose turn just completed, each timer being cascaded at most LEVELS-1
+// times on its way down. A timer fires on the first tick at or after its
+// deadline - at most one tick late - and remaining() is exact to the
+// nanosecond. Callbacks may schedule and cancel freely.
+class TimerWheel {
+public:
+    using Duration = std::chrono::nanoseconds;
+    static constexpr Duration TICK = std::chrono::milliseconds(1);
+    static constexpr unsigned SLOT_BITS = 6;
+    static constexpr unsigned SLOTS = 1u << SLOT_BITS;
+    static constexpr unsigned LEVELS = 4; // 64^4 ticks = about 4.6 hours; later deadlines wait at the top
+
+private:
+    static constexpr std::uint32_t NONE = 0xFFFFFFFFu;
+
+    struct Node {
+        Duration deadline;         // Exact, in wheel time
+        std::uint64_t expiry;      // Tick it fires on
+        std::function<void()> callback;
+        std::uint32_t prev;        // Slot list links (next doubles as the free list)
+        std::uint32_t next;
+        std::uint32_t slot;        // level * SLOTS + index; NONE when free
+        std::uint32_t generation;  // Bumped on every release, so old ids go stale
+    };
+
+    std::vector<Node> nodes;
+    std::array<std::uint32_t, LEVELS * SLOTS> heads;
+    std::uint32_t freeList;
+    std::size_t pending;
+    Duration now;
+    std::uint64_t tick;   // Last tick processed
+
+    void link(std::uint32_t index);   // Into the slot its expiry maps to from the current tick
+    void unlink(std::uint32_t index);
+    void release(std::uint32_t index);
+    Node* find(TimerId id);
+    const Node* find(TimerId id) const;
+    void cascade(unsigned level);
+    void fire();
+
+public:
+    TimerWheel();
+
+    TimerId schedule(Duration delay, std::function<void()> callback);
+    bool cancel(TimerId id);            // False if it already fired or was cancelled
+    bool isPending(TimerId id) const;
+    Duration remaining(TimerId id) const; // Zero when not pending
+
+    void advance(Duration elapsed);      // Fires everything due, in tick order
+    void clear();                        // Drops every timer without firing it
+
+    Duration getNow() const;
+    std::size_t getPendingCount() const;
+};
+
+#endif // TIMERWHEEL_H
@@ -0,0 +1,117 @@
+/*
+ * Museum Escape - Tween System Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "Tween.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace {
+    float eased(Ease ease, float t) {
+        switch (ease) {
+            case Ease::SmoothStep: return t * t * (3.0f - 2.0f * t);
+            case Ease::Linear: break;
+        }
+        return t;
+    }
+
+    std::uint8_t mix(std::uint8_t from, std::uint8_t to, float t) {
+        return static_cast<std::uint8_t>(std::lround(from + (to - from) * t));
+    }
+}
+
+void TweenSystem::apply(Tween& tween, float progress) {
+    switch (tween.property) {
+        case Property::VertexColor: {
+            sf::Color color(mix(tween.fromColor.r, tween.toColor.r, progress),
+                            mix(tween.fromColor.g, tween.toColor.g, progress),
+                            mix(tween.fromColor.b, tween.toColor.b, progress),
+                            mix(tween.fromColor.a, tween.toColor.a, progress));
+            for (std::size_t i = 0; i < tween.vertexCount; ++i) tween.vertices[i].color = color;
+            break;
+        }
+        case Property::Position:
+            tween.transformable->setPosition(tween.fromPosition + (tween.toPosition - tween.fromPosition) * progress);
+            break;
+    }
+}
+
+std::size_t TweenSystem::find(const void* target) const {
+    for (std::size_t i = 0; i < tweens.size(); ++i) {
+        if (tweens[i].target == target) return i;
+    }
+    return tweens.size();
+}
+
+void TweenSystem::start(const Tween& tween) {
+    std::size_t index = find(tween.target);
+    if (index == tweens.size()) tweens.push_back(tween);
+    else tweens[index] = tween;
+    apply(tweens[index], 0.0f);
+}
+
+void TweenSystem::tweenColor(sf::Vertex* vertices, std::size_t count, sf::Color from, sf::Color to,
+                             float seconds, Ease ease) {
+    Tween tween{};
+    tween.property = Property::VertexColor;
+    tween.target = vertices;
+    tween.vertices = vertices;
+    tween.vertexCount = count;
+    tween.fromColor = from;
+    tween.toColor = to;
+    tween.duration = seconds;
+    tween.ease = ease;
+    start(tween);
+}
+
+void TweenSystem::tweenPosition(sf::Transformable& transformable, sf::Vector2f from, sf::Vector2f to,
+                                float seconds, Ease ease) {
+    Tween tween{};
+    tween.property = Property::Position;
+    tween.target = &transformable;
+    tween.transformable = &transformable;
+    tween.fromPosition = from;
+    tween.toPosition = to;
+    tween.duration = seconds;
+    tween.ease = ease;
+    start(tween);
+}
+
+// One pass over the array; a finished tween lands on its end value and the
+// last one takes its place
+void TweenSystem::update(float deltaTime) {
+    for (std::size_t i = 0; i < tweens.size();) {
+        Tween& tween = tweens[i];
+        tween.elapsed += deltaTime;
+        if (tween.elapsed >= tween.duration) {
+            apply(tween, 1.0f);
+            tweens[i] = tweens.back();
+            tweens.pop_back();
+            continue;
+        }
+        apply(tween, eased(tween.ease, tween.elapsed / tween.duration));
+        ++i;
+    }
+}
+
+void TweenSystem::finish(const void* target) {
+    std::size_t index = find(target);
+    if (index == tweens.size()) return;
+    apply(tweens[index], 1.0f);
+    tweens[index] = tweens.back();
+    tweens.pop_back();
+}
+
+void TweenSystem::stop(const void* target) {
+    std::size_t index = find(target);
+    if (index == tweens.size()) return;
+    tweens[index] = tweens.back();
+    tweens.pop_back();
+}
+
+void TweenSystem::clear() { tweens.clear(); }
+
+bool TweenSystem::isAnimating(const void* target) const { return find(target) < tweens.size(); }
+std::size_t TweenSystem::getActiveCount() const { return tweens.size(); }
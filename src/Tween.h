@@ -0,0 +1,56 @@
+#ifndef TWEEN_H
+#define TWEEN_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+
+enum class Ease { Linear, SmoothStep };
+
+// TweenSystem - every running animation in one contiguous array, advanced in
+// a single pass per frame. A tween writes straight into what gets drawn - the
+// colour of a run of vertices, or a Transformable's position - so animated
+// things keep no fade state of their own. Finished tweens are swapped out of
+// the array; with nothing animating, update() returns at once.
+//
+// Targets are not owned: stop or finish a target's tween (or clear()) before
+// it is destroyed.
+class TweenSystem {
+private:
+    enum class Property { VertexColor, Position };
+
+    struct Tween {
+        Property property;
+        const void* target;         // For lookups; the vertices or the Transformable
+        sf::Vertex* vertices;       // VertexColor
+        std::size_t vertexCount;
+        sf::Transformable* transformable; // Position
+        sf::Color fromColor, toColor;
+        sf::Vector2f fromPosition, toPosition;
+        float elapsed;
+        float duration;
+        Ease ease;
+    };
+
+    std::vector<Tween> tweens;
+
+    static void apply(Tween& tween, float progress); // progress 0..1, already eased
+    std::size_t find(const void* target) const;     // tweens.size() = none
+    void start(const Tween& tween);                  // Replaces the target's running tween
+
+public:
+    void tweenColor(sf::Vertex* vertices, std::size_t count, sf::Color from, sf::Color to,
+                    float seconds, Ease ease = Ease::Linear);
+    void tweenPosition(sf::Transformable& transformable, sf::Vector2f from, sf::Vector2f to,
+                       float seconds, Ease ease = Ease::SmoothStep);
+
+    void update(float deltaTime);
+    void finish(const void* target); // Jump to the end value and retire
+    void stop(const void* target);   // Retire where it is
+    void clear();                    // Retire everything where it is
+
+    bool isAnimating(const void* target) const;
+    std::size_t getActiveCount() const;
+};
+
+#endif // TWEEN_H
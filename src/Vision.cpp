@@ -0,0 +1,47 @@
+/*
+ * Museum Escape - Guard Vision Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "Vision.h"
+#include "CollisionMap.h"
+#include "JobSystem.h"
+#include <cmath>
+
+namespace {
+    // Cones per job; smaller batches cost less than handing them to another thread
+    const std::size_t BATCH_GRAIN = 256;
+
+    void detectRange(const CollisionMap& map, const VisionCone* cones, std::size_t begin, std::size_t end,
+                     const sf::Vector2f& target, std::uint8_t* seen) {
+        // Pass 1: range and angle, no branches on the hot path
+        for (std::size_t i = begin; i < end; ++i) {
+            const VisionCone& cone = cones[i];
+            float dx = target.x - cone.origin.x;
+            float dy = target.y - cone.origin.y;
+            float distanceSquared = dx * dx + dy * dy;
+            float along = dx * cone.facing.x + dy * cone.facing.y;
+            // cos(angle) >= cosHalfAngle, compared without the square root
+            bool inFront = along > 0.0f && along * along >= cone.cosHalfAngle * cone.cosHalfAngle * distanceSquared;
+            bool inRange = distanceSquared <= cone.range * cone.range;
+            bool atFeet = distanceSquared < 1.0f;
+            seen[i] = static_cast<std::uint8_t>(inRange && (inFront || atFeet || cone.cosHalfAngle <= -1.0f));
+        }
+
+        // Pass 2: line of sight for the survivors only
+        for (std::size_t i = begin; i < end; ++i) {
+            if (seen[i] && !map.hasLineOfSight(cones[i].origin, target)) seen[i] = 0;
+        }
+    }
+}
+
+void detectInBatch(const CollisionMap& map, const VisionCone* cones, std::size_t count,
+                   const sf::Vector2f& target, std::uint8_t* seen, JobSystem* jobs) {
+    if (!jobs) {
+        detectRange(map, cones, 0, count, target, seen);
+        return;
+    }
+    jobs->parallelFor(count, BATCH_GRAIN, [&](std::size_t begin, std::size_t end) {
+        detectRange(map, cones, begin, end, target, seen);
+    });
+}
@@ -0,0 +1,27 @@
+#ifndef VISION_H
+#define VISION_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+
+class CollisionMap;
+class JobSystem;
+
+// A guard's field of view: a cone from origin along facing, out to range
+struct VisionCone {
+    sf::Vector2f origin;
+    sf::Vector2f facing;  // Unit vector
+    float range;
+    float cosHalfAngle;   // cos(half the field of view)
+};
+
+// Test every cone against one target point in a single pass: seen[i] = 1 if
+// cone i sees it. Range and angle are plain arithmetic over the whole batch;
+// only cones that pass both pay for a line-of-sight walk through the room's
+// tiles (CollisionMap::hasLineOfSight). Large batches are split across the
+// job system's threads when one is given.
+void detectInBatch(const CollisionMap& map, const VisionCone* cones, std::size_t count,
+                   const sf::Vector2f& target, std::uint8_t* seen, JobSystem* jobs = nullptr);
+
+#endif // VISION_H
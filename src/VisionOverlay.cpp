@@ -0,0 +1,91 @@
+/*
+ * Museum Escape - Vision Overlay Implementation
+ * CS/CE 224/272 - Fall 2025
+ */
+
+#include "VisionOverlay.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+    const sf::Color CONE_FILL(255, 0, 0, 30);
+    const sf::Color CONE_OUTLINE(255, 0, 0, 100);
+    const float OUTLINE_THICKNESS = 1.0f;
+
+    sf::Vector2f outwardNormal(sf::Vector2f from, sf::Vector2f to, sf::Vector2f center) {
+        sf::Vector2f edge = to - from;
+        float length = std::sqrt(edge.x * edge.x + edge.y * edge.y);
+        sf::Vector2f normal = length > 0.0f ? sf::Vector2f(-edge.y, edge.x) / length : sf::Vector2f();
+        return normal.dot(from - center) < 0.0f ? -normal : normal;
+    }
+}
+
+VisionOverlay::VisionOverlay() : coneCount(0) {}
+
+// Same outline as sf::Shape: each corner pushed out along the mean of its two
+// edge normals, the ring drawn as one quad per edge
+const VisionOverlay::Template& VisionOverlay::templateFor(float range, float cosHalfAngle) {
+    for (const Template& cached : templates) {
+        if (cached.range == range && cached.cosHalfAngle == cosHalfAngle) return cached;
+    }
+
+    sf::Vector2f points[POINTS];
+    points[0] = {0.0f, 0.0f};
+    float halfAngle = std::acos(std::clamp(cosHalfAngle, -1.0f, 1.0f));
+    for (int i = 0; i <= ARC_SEGMENTS; ++i) {
+        float angle = -halfAngle + 2.0f * halfAngle * i / ARC_SEGMENTS;
+        points[i + 1] = {std::cos(angle) * range, std::sin(angle) * range};
+    }
+    sf::Vector2f center;
+    for (const sf::Vector2f& point : points) center += point / static_cast<float>(POINTS);
+
+    Template shape{range, cosHalfAngle, {}};
+    shape.vertices.reserve(VERTICES_PER_CONE);
+    for (int i = 1; i <= ARC_SEGMENTS; ++i) {
+        for (sf::Vector2f corner : {points[0], points[i], points[i + 1]}) shape.vertices.push_back({corner, CONE_FILL});
+    }
+
+    sf::Vector2f outer[POINTS];
+    for (std::size_t i = 0; i < POINTS; ++i) {
+        sf::Vector2f before = points[(i + POINTS - 1) % POINTS];
+        sf::Vector2f after = points[(i + 1) % POINTS];
+        sf::Vector2f n1 = outwardNormal(before, points[i], center);
+        sf::Vector2f n2 = outwardNormal(points[i], after, center);
+        float factor = 1.0f + n1.dot(n2);
+        outer[i] = points[i] + (n1 + n2) / factor * OUTLINE_THICKNESS;
+    }
+    for (std::size_t i = 0; i < POINTS; ++i) {
+        std::size_t next = (i + 1) % POINTS;
+        for (sf::Vector2f corner : {points[i], outer[i], outer[next], points[i], outer[next], points[next]}) {
+            shape.vertices.push_back({corner, CONE_OUTLINE});
+        }
+    }
+
+    templates.push_back(std::move(shape));
+    return templates.back();
+}
+
+void VisionOverlay::clear() { coneCount = 0; }
+
+void VisionOverlay::add(const VisionCone& cone) {
+    const Template& shape = templateFor(cone.range, cone.cosHalfAngle);
+    std::size_t base = coneCount * VERTICES_PER_CONE;
+    if (vertices.size() < base + VERTICES_PER_CONE) {
+        vertices.insert(vertices.end(), shape.vertices.begin(), shape.vertices.end()); // Colours come along
+    }
+
+    // Rotate the template onto facing (a unit vector) and move it to the origin
+    for (std::size_t i = 0; i < VERTICES_PER_CONE; ++i) {
+        sf::Vector2f local = shape.vertices[i].position;
+        vertices[base + i].position = cone.origin + sf::Vector2f(local.x * cone.facing.x - local.y * cone.facing.y,
+                                                                 local.x * cone.facing.y + local.y * cone.facing.x);
+    }
+    ++coneCount;
+}
+
+void VisionOverlay::draw(RenderQueue& queue) const {
+    if (coneCount == 0) return;
+    queue.submit(RenderLayer::Markers, vertices.data(), coneCount * VERTICES_PER_CONE, sf::PrimitiveType::Triangles);
+}
+
+std::size_t VisionOverlay::getConeCount() const { return coneCount; }
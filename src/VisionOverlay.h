@@ -0,0 +1,44 @@
+#ifndef VISIONOVERLAY_H
+#define VISIONOVERLAY_H
+
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <vector>
+#include "Vision.h"
+#include "RenderQueue.h"
+
+// VisionOverlay - every cone in a room drawn as one triangle list, one draw
+// call however many guards there are. Each range/angle is tessellated once
+// (fill fan plus a 1-pixel outline, pointing along +x) and cached; per frame
+// a cone only rotates and moves that template into its slot. The vertex
+// colours are written when a slot is first used and never again.
+class VisionOverlay {
+public:
+    static constexpr int ARC_SEGMENTS = 16;
+    static constexpr std::size_t POINTS = ARC_SEGMENTS + 2; // Apex plus the arc
+    static constexpr std::size_t VERTICES_PER_CONE = ARC_SEGMENTS * 3 + POINTS * 6;
+
+private:
+    struct Template {
+        float range;
+        float cosHalfAngle;
+        std::vector<sf::Vertex> vertices; // VERTICES_PER_CONE, around the origin
+    };
+
+    std::vector<Template> templates;
+    std::vector<sf::Vertex> vertices; // Slots of VERTICES_PER_CONE; kept between frames
+    std::size_t coneCount;            // Slots in use this frame
+
+    const Template& templateFor(float range, float cosHalfAngle);
+
+public:
+    VisionOverlay();
+
+    void clear();                     // Start a frame
+    void add(const VisionCone& cone);
+    void draw(RenderQueue& queue) const; // One command on the markers layer
+
+    std::size_t getConeCount() const;
+};
+
+#endif // VISIONOVERLAY_H
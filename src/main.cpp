@@ -4,13 +4,156 @@
  * Team: Hamza Sami & Mohammad Yousuf Lali
  */
 
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <string>
 #include "Game.h"
+#include "Level.h"
+#include "DefaultLevel.h"
+#include "StressLevel.h"
+#include "MicroBench.h"
+#include "Replay.h"
 
-int main() {
+namespace {
+    const double REGRESSION_TOLERANCE = 0.10; // --microbench: slower than baseline by more than this fails
+}
+
+// Usage:
+//   game.exe                          - play (assets/museum.lvlc, else the built-in museum)
+//   game.exe <level.lvl|level.lvlc>   - play a specific level
+//   game.exe --cook <in.lvl> <out.lvlc>
+//   game.exe --validate <level.lvl|level.lvlc> [--museum]   - load and check; --museum also
+//                                                             requires it to match DefaultLevel.h
+//   game.exe --generate <out.lvl> <rooms> <guardsPerRoom> <items> [seed]
+//   game.exe --stress <level.lvl|level.lvlc> [framesPerRoom]   - per-phase timings
+//   game.exe --microbench <out.json> [baseline.json]            - fails on >10% regressions
+//   game.exe --record <out.replay> [level]                      - play and save the input
+//   game.exe --bench <session.replay> <report.json> [level]     - replay flat out, report as JSON
+int main(int argc, char* argv[]) {
+    if (argc == 4 && std::string(argv[1]) == "--cook") {
+        Level level;
+        std::string error;
+        if (!level.loadFromFile(argv[2])) {
+            std::cerr << "Error: " << level.getError() << std::endl;
+            return EXIT_FAILURE;
+        }
+        if (!Level::saveCooked(level.getView(), argv[3], &error)) {
+            std::cerr << "Error: " << error << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::cout << "Cooked " << argv[2] << " -> " << argv[3] << std::endl;
+        return EXIT_SUCCESS;
+    }
+    
+    if ((argc == 3 || (argc == 4 && std::string(argv[3]) == "--museum")) && std::string(argv[1]) == "--validate") {
+        Level level;
+        std::string difference;
+        if (!level.loadFromFile(argv[2])) {
+            std::cerr << "Error: " << level.getError() << std::endl;
+            return EXIT_FAILURE;
+        }
+        if (argc == 4 && !Level::sameContent(level.getView(), DEFAULT_MUSEUM_LEVEL, difference)) {
+            std::cerr << "Error: " << argv[2] << " does not match the built-in museum: " << difference << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::cout << argv[2] << " is valid" << (argc == 4 ? " and matches the built-in museum" : "") << std::endl;
+        return EXIT_SUCCESS;
+    }
+    
+    if ((argc == 6 || argc == 7) && std::string(argv[1]) == "--generate") {
+        StressLevelOptions options;
+        options.roomCount = std::atoi(argv[3]);
+        options.guardsPerRoom = std::atoi(argv[4]);
+        options.itemCount = std::atoi(argv[5]);
+        if (argc == 7) options.seed = static_cast<unsigned>(std::strtoul(argv[6], nullptr, 10));
+        
+        std::ofstream out(argv[2], std::ios::binary);
+        out << generateStressLevel(options);
+        if (!out) {
+            std::cerr << "Error: cannot write " << argv[2] << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::cout << "Generated " << argv[2] << std::endl;
+        return EXIT_SUCCESS;
+    }
+    
+    if ((argc == 3 || argc == 4) && std::string(argv[1]) == "--stress") {
+        try {
+            Game game(argv[2]);
+            game.runStress(argc == 4 ? std::atoi(argv[3]) : 120);
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    
+    if ((argc == 3 || argc == 4) && std::string(argv[1]) == "--microbench") {
+        MicroBench bench;
+        try {
+            Game game;
+            game.runMicroBenchmarks(bench);
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+        bench.print(std::cout);
+        if (!bench.writeJson(argv[2])) {
+            std::cerr << "Error: cannot write " << argv[2] << std::endl;
+            return EXIT_FAILURE;
+        }
+        if (argc == 4) {
+            std::vector<BenchResult> baseline;
+            if (!MicroBench::readJson(argv[3], baseline)) {
+                std::cerr << "Error: cannot read baseline " << argv[3] << std::endl;
+                return EXIT_FAILURE;
+            }
+            int regressions = bench.compare(baseline, REGRESSION_TOLERANCE, std::cout);
+            if (regressions > 0) {
+                std::cerr << regressions << " benchmark(s) regressed" << std::endl;
+                return EXIT_FAILURE;
+            }
+        }
+        return EXIT_SUCCESS;
+    }
+    
+    if ((argc == 3 || argc == 4) && std::string(argv[1]) == "--record") {
+        Replay replay;
+        try {
+            Game game(argc == 4 ? argv[3] : "");
+            game.record(replay);
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+        if (!replay.saveToFile(argv[2])) {
+            std::cerr << "Error: cannot write " << argv[2] << std::endl;
+            return EXIT_FAILURE;
+        }
+        std::cout << "Recorded " << argv[2] << std::endl;
+        return EXIT_SUCCESS;
+    }
+    
+    if ((argc == 4 || argc == 5) && std::string(argv[1]) == "--bench") {
+        Replay session;
+        if (!session.loadFromFile(argv[2])) {
+            std::cerr << "Error: " << session.getError() << std::endl;
+            return EXIT_FAILURE;
+        }
+        try {
+            Game game(argc == 5 ? argv[4] : "");
+            if (!game.runBench(session, argv[3])) return EXIT_FAILURE;
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+    
     try {
         // Create game instance
-        Game game;
+        Game game(argc > 1 ? argv[1] : "");
         
         // Run the game loop
         game.run();